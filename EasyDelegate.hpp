@@ -377,22 +377,51 @@ Exhibit B - "Incompatible With Secondary Licenses" Notice
  */
 
 #pragma once
+#include "EasyDelegateThreadPoolImpl.hpp"
 #include "EasyDelegateAnyCTImpl.hpp"
 #include "EasyDelegateMultiImpl.hpp"
+#include "EasyDelegateMultiCTImpl.hpp"
+#include "EasyDelegateFrozenImpl.hpp"
 #include "EasyDelegateAnyImpl.hpp"
+#include "EasyDelegateDispatcherImpl.hpp"
+#include "EasyDelegateTracingImpl.hpp"
+#include "EasyDelegateSlowDetectorImpl.hpp"
+#include "EasyDelegateDeferredImpl.hpp"
+#include "EasyDelegateTimerWheelImpl.hpp"
+#include "EasyDelegateMemoImpl.hpp"
+#include "EasyDelegateComposeImpl.hpp"
+#include "EasyDelegateBindImpl.hpp"
 
 /**
  * @brief Mechanism for creating a global delegate of the compilation-time.
+ *  The delegate is constant-initialized, so the declaration costs nothing at startup.
  *  This declarations should be in cpp file.
  */
 #define DeclareDelegateFuncCompileTime(eEnumeraror, eBase, fSignature) \
+template<> struct EasyDelegate::__IsDelegateDeclared<TakeStoreKey<eEnumeraror, eBase>()> : std::true_type {}; \
 template<> struct EasyDelegate::__DelegateTypeStore<TakeStoreKey<eEnumeraror, eBase>()> \
 { \
+    static_assert(EasyDelegate::IsDeclarableKey(eBase), "Key is outside of __DelegateKeyRange of the strict enumerator, specialize the range before the declaration."); \
     using type = EasyDelegate::__Delegate<fSignature>; \
     using signature = fSignature; \
 }; \
-template<> struct EasyDelegate::__DelegateObjectStore<TakeStoreKey<eEnumeraror, eBase>()> { static EasyDelegate::__Delegate<fSignature> value; }; \
-EasyDelegate::__Delegate<fSignature> EasyDelegate::__DelegateObjectStore<TakeStoreKey<eEnumeraror, eBase>()>::value;
+template<> struct EasyDelegate::__DelegateObjectStore<TakeStoreKey<eEnumeraror, eBase>()> { static EasyDelegate::__DelegateGlobal<fSignature> value; }; \
+EASY_DELEGATE_CONSTINIT EasyDelegate::__DelegateGlobal<fSignature> EasyDelegate::__DelegateObjectStore<TakeStoreKey<eEnumeraror, eBase>()>::value;
+
+/**
+ * @brief Mechanism for creating a global delegate of the compilation-time that is already bound to the static function.
+ *  This declarations should be in cpp file.
+ */
+#define DeclareDelegateFuncCompileTimeBound(eEnumeraror, eBase, fSignature, fFunction) \
+template<> struct EasyDelegate::__IsDelegateDeclared<TakeStoreKey<eEnumeraror, eBase>()> : std::true_type {}; \
+template<> struct EasyDelegate::__DelegateTypeStore<TakeStoreKey<eEnumeraror, eBase>()> \
+{ \
+    static_assert(EasyDelegate::IsDeclarableKey(eBase), "Key is outside of __DelegateKeyRange of the strict enumerator, specialize the range before the declaration."); \
+    using type = EasyDelegate::__Delegate<fSignature>; \
+    using signature = fSignature; \
+}; \
+template<> struct EasyDelegate::__DelegateObjectStore<TakeStoreKey<eEnumeraror, eBase>()> { static EasyDelegate::__DelegateGlobal<fSignature> value; }; \
+EASY_DELEGATE_CONSTINIT EasyDelegate::__DelegateGlobal<fSignature> EasyDelegate::__DelegateObjectStore<TakeStoreKey<eEnumeraror, eBase>()>::value{EasyDelegate::__DelegateGlobal<fSignature>::make<fFunction>()};
 
 /**
  * @brief Mechanism for creating a delegate for runtime __DelegateAny.
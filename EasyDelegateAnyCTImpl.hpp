@@ -377,12 +377,32 @@ Exhibit B - "Incompatible With Secondary Licenses" Notice
  */
 
 #pragma once
+#include <array>
+#include <utility>
 #include "EasyDelegateImpl.hpp"
+#include "EasyDelegateGlobalImpl.hpp"
 
 namespace EasyDelegate
 {
     /**
-     * @brief Implementation of global compile-time delegates. Not working for now
+     * @brief Result of executing the delegate by a runtime key
+     * 
+     */
+    enum class EDelegateKeyStatus : uint8_t
+    {
+        //Delegate was attached and called
+        ECalled,
+        //Key is declared for the arguments, but no delegate is attached
+        EDetached,
+        //Key inside of __DelegateKeyRange is not declared, returns a value or takes other arguments
+        EUnknownKey,
+        //Key is outside of __DelegateKeyRange, its declaration can't be reached by a runtime key
+        EOutOfRange
+    };
+
+    /**
+     * @brief Implementation of global compile-time delegates. Keys can be passed as template parameters 
+     * or at runtime, runtime keys are resolved through a jump table generated from the declared keys.
      * 
      * @tparam _Enumerator Enumerator class
      */
@@ -399,8 +419,7 @@ namespace EasyDelegate
         template<_Enumerator eBase, class _LabbdaFunction>
 		static inline void attach(_LabbdaFunction&& lfunc) noexcept
         {
-            using _delegate_t = typename __DelegateTypeStore<TakeStoreKey<_Enumerator, eBase>()>::type;
-            _delegate_t& _delegate = __DelegateObjectStore<TakeStoreKey<_Enumerator, eBase>()>::value;
+            auto& _delegate = __DelegateObjectStore<TakeStoreKey<_Enumerator, eBase>()>::value;
             _delegate.attach(std::forward<_LabbdaFunction>(lfunc));
         }
 
@@ -414,11 +433,24 @@ namespace EasyDelegate
         template <_Enumerator eBase, class... Args>
         static inline void attach(Args &&...args) noexcept
         {
-            using _delegate_t = typename __DelegateTypeStore<TakeStoreKey<_Enumerator, eBase>()>::type;
-            _delegate_t& _delegate = __DelegateObjectStore<TakeStoreKey<_Enumerator, eBase>()>::value;
+            auto& _delegate = __DelegateObjectStore<TakeStoreKey<_Enumerator, eBase>()>::value;
             _delegate.attach(std::forward<Args>(args)...);
         }
 
+        /**
+         * @brief Binds the static function known at compile time. Rebinding is a single atomic store, 
+         * so it can be done while other threads are calling the delegate.
+         * 
+         * @tparam eBase User defined enumeration key
+         * @tparam _Function Static function pointer
+         */
+        template <_Enumerator eBase, auto _Function>
+        static inline void attach() noexcept
+        {
+            auto& _delegate = __DelegateObjectStore<TakeStoreKey<_Enumerator, eBase>()>::value;
+            _delegate.template attach<_Function>();
+        }
+
         /**
          * @brief Breaks a connection between the method and the enumerator
          * 
@@ -428,8 +460,7 @@ namespace EasyDelegate
         template <_Enumerator eBase>
         static inline void detach() noexcept
         {
-            using _delegate_t = typename __DelegateTypeStore<TakeStoreKey<_Enumerator, eBase>()>::type;
-            _delegate_t& _delegate = __DelegateObjectStore<TakeStoreKey<_Enumerator, eBase>()>::value;
+            auto& _delegate = __DelegateObjectStore<TakeStoreKey<_Enumerator, eBase>()>::value;
             _delegate.detach();
         }
 
@@ -440,7 +471,7 @@ namespace EasyDelegate
          * @tparam Args Templated std::tuple arguments 
          * @param args Delegate arguments
          */
-        template<class ...Args>
+        template<_Enumerator eBase, class ...Args>
         static inline void execute(Args&&... args)
         {
             using _sign_t = typename __DelegateTypeStore<TakeStoreKey<_Enumerator, eBase>()>::signature;
@@ -470,6 +501,91 @@ namespace EasyDelegate
             auto &_delegate = __DelegateObjectStore<TakeStoreKey<_Enumerator, eBase>()>::value;
             return _delegate(std::forward<Args>(args)...);
         }
+
+        /**
+         * @brief Executes the delegate for the key known only at runtime (config, IPC...). 
+         * The key is resolved through the table of thunks generated from all keys declared with DeclareDelegateFuncCompileTime 
+         * inside __DelegateKeyRange. Keys with 'non-void' return type or incompatible arguments are skipped. Every translation unit 
+         * that executes by a runtime key should see all declarations of the enumerator before the first such call, a declaration 
+         * placed after the table was instantiated fails to compile.
+         * 
+         * @tparam Args Templated std::tuple arguments 
+         * @param eKey User defined enumeration key
+         * @param args Delegate arguments
+         * @return true if the delegate was attached and called, see try_execute for the reason of a failure
+         */
+        template<class ...Args>
+        static inline bool execute(_Enumerator eKey, Args&&... args)
+        {
+            return try_execute(eKey, std::forward<Args>(args)...) == EDelegateKeyStatus::ECalled;
+        }
+
+        /**
+         * @brief Executes the delegate for the key known only at runtime and reports why it was not called. 
+         * EOutOfRange means that __DelegateKeyRange of the enumerator should be widened if the key is declared.
+         * 
+         * @tparam Args Templated std::tuple arguments 
+         * @param eKey User defined enumeration key
+         * @param args Delegate arguments
+         * @return EDelegateKeyStatus Status of the call
+         */
+        template<class ...Args>
+        static inline EDelegateKeyStatus try_execute(_Enumerator eKey, Args&&... args)
+        {
+            static constexpr auto table = _MakeTable<Args...>(std::make_integer_sequence<uint32_t, _KeyCount>{});
+
+            const uint32_t index = TakeKeyIndex(eKey) - __DelegateKeyRange<_Enumerator>::first;
+            if (index >= table.size())
+            {
+                return EDelegateKeyStatus::EOutOfRange;
+            }
+            if (!table[index])
+            {
+                return EDelegateKeyStatus::EUnknownKey;
+            }
+            return table[index](std::forward<Args>(args)...) ? EDelegateKeyStatus::ECalled : EDelegateKeyStatus::EDetached;
+        }
+
+    private:
+        static constexpr uint32_t _KeyCount = __DelegateKeyRange<_Enumerator>::last - __DelegateKeyRange<_Enumerator>::first + 1;
+
+        template<_Enumerator eBase, class ...Args>
+        static bool _Thunk(Args&&... args)
+        {
+            auto &_delegate = __DelegateObjectStore<TakeStoreKey<_Enumerator, eBase>()>::value;
+            return _delegate.try_invoke(std::forward<Args>(args)...);
+        }
+
+        template<_Enumerator eBase, class ...Args>
+        static constexpr auto _SelectThunk() noexcept -> bool (*)(Args&&...)
+        {
+            if constexpr (__IsDelegateDeclared<TakeStoreKey<_Enumerator, eBase>()>::value)
+            {
+                using _sign_t = typename __DelegateTypeStore<TakeStoreKey<_Enumerator, eBase>()>::signature;
+                using return_type = typename __SignatureDesc<_sign_t>::return_type;
+                if constexpr (std::is_same<return_type, void>::value && std::is_invocable<std::function<_sign_t>&, Args&&...>::value)
+                {
+                    return &_Thunk<eBase, Args...>;
+                }
+                else
+                {
+                    return nullptr;
+                }
+            }
+            else
+            {
+                return nullptr;
+            }
+        }
+
+        template<class ...Args, uint32_t ...Indices>
+        static constexpr auto _MakeTable(std::integer_sequence<uint32_t, Indices...>) noexcept
+        {
+            using _underlying_t = std::underlying_type_t<_Enumerator>;
+            return std::array<bool (*)(Args&&...), sizeof...(Indices)>{
+                _SelectThunk<static_cast<_Enumerator>(static_cast<_underlying_t>(__DelegateKeyRange<_Enumerator>::first + Indices)), Args...>()...
+            };
+        }
     };
 
     template <class _Enumerator>
@@ -485,26 +601,46 @@ namespace EasyDelegate
 
 using namespace EasyDelegate;
 
-//    An important note. You cannot use TDelegateAny and TDelegateAnyCT at the 
-//    same time due to some technical problems. The same is the case with the 
-//    enumerator. When the problem is resolved, this will be indicated in the update.
-
-// If you want use multiple enums, start new enum with higher index
+//    Keys keep the type of their enumerator, so every enumerator can start from zero
+//    and TDelegateAny can be used together with TDelegateAnyCT.
 enum class EEnumerator
 {
-    EIntDelegate = 100,
-    EBoolDelegate
+    EIntDelegate,
+    EBoolDelegate,
+    EPrintDelegate,
+    EBoundDelegate
+};
+
+//Another enumerator with the same values, used with runtime container
+enum class ERuntimeEnumerator
+{
+    EFloatDelegate
 };
 
 //This declarations should be in cpp file
 DeclareDelegateFuncCompileTime(EEnumerator, EEnumerator::EIntDelegate, int(int, int, bool))
 DeclareDelegateFuncCompileTime(EEnumerator, EEnumerator::EBoolDelegate, bool(bool, bool))
+DeclareDelegateFuncCompileTime(EEnumerator, EEnumerator::EPrintDelegate, void(int))
+DeclareDelegateFuncRuntime(ERuntimeEnumerator, ERuntimeEnumerator::EFloatDelegate, float(float))
 
-        int foo(int x, int y, bool ts)
+int foo(int x, int y, bool ts)
 {
     return ts ? x : y;
 }
 
+int square(int x)
+{
+    return x * x;
+}
+
+int cube(int x)
+{
+    return x * x * x;
+}
+
+//Global delegate bound to the function at compile time, nothing is executed at startup
+DeclareDelegateFuncCompileTimeBound(EEnumerator, EEnumerator::EBoundDelegate, int(int), &square)
+
 class Foo
 {
 public:
@@ -540,6 +676,28 @@ int main()
 
     std::cout << lresult << std::endl;
 
+    //Executing by the key that is known only at runtime, for example read from config
+    TDelegateAnyCT<EEnumerator>::attach<EEnumerator::EPrintDelegate>([](int i)
+    {
+        std::cout << "Print " << i << std::endl;
+    });
+    uint32_t iConfigKey = 2;
+    auto eRuntimeKey = static_cast<EEnumerator>(iConfigKey);
+    TDelegateAnyCT<EEnumerator>::execute(eRuntimeKey, iresult);
+    //Returns false, because key has 'non-void' return type
+    TDelegateAnyCT<EEnumerator>::execute(EEnumerator::EIntDelegate, iresult);
+
+    //Bound delegate can be called without attach
+    std::cout << TDelegateAnyCT<EEnumerator>::eval<EEnumerator::EBoundDelegate>(7) << std::endl;
+    //Rebinding static function is a single atomic store, other threads can call the delegate meanwhile
+    TDelegateAnyCT<EEnumerator>::attach<EEnumerator::EBoundDelegate, &cube>();
+    std::cout << TDelegateAnyCT<EEnumerator>::eval<EEnumerator::EBoundDelegate>(3) << std::endl;
+
+    //Runtime container next to the global one
+    TDelegateAny<ERuntimeEnumerator> _delegates;
+    _delegates.attach<ERuntimeEnumerator::EFloatDelegate>([](float f) { return f * 2.f; });
+    std::cout << _delegates.eval<ERuntimeEnumerator::EFloatDelegate>(1.5f) << std::endl;
+
     return 0;
 }
     @endcode
@@ -384,12 +384,13 @@ namespace EasyDelegate
 {
 	/**
 	 * @brief A container for creating delegates at the program execution stage. Allows you to add delegates with any signature, 
-	 * and make their further call. At the moment, it cannot be used together with TDelegateAnyCT and vice versa.
+	 * and make their further call. Keys of different enumerators never collide, so it can be used together with TDelegateAnyCT.
 	 * 
 	 * @tparam _Enumerator 
 	 * @tparam _Signature 
+	 * @tparam _Policy Instrumentation policy, calls are recorded under the key index
 	 */
-	template<class _Enumerator, class _Comp>
+	template<class _Enumerator, class _Comp, class _Policy>
 	struct __DelegateAny
 	{
 		/**
@@ -403,7 +404,7 @@ namespace EasyDelegate
         {
 			using _sign_t = typename __DelegateTypeStore<TakeStoreKey<_Enumerator, eBase>()>::signature;
             static_assert(std::is_same<
-            std::remove_reference<decltype(_delegate)>::type, __Delegate<_sign_t>>::value,
+            typename std::remove_reference<decltype(_delegate)>::type, __Delegate<_sign_t>>::value,
             "Attached delegate has diferent signatures." );
             m_Delegates.emplace(eBase, std::move(_delegate));
         }
@@ -441,20 +442,14 @@ namespace EasyDelegate
 		}
 
 		/** 
-		 * @brief Detaching delegate
+		 * @brief Detaching delegate. The key is removed, so it can be attached again.
 		 * 
 		 * @tparam eBase User defined enumeration key
 		 */
 		template<_Enumerator eBase>
 		inline void detach()
 		{
-			using _delegate_t = typename __DelegateTypeStore<TakeStoreKey<_Enumerator, eBase>()>::type;
-			_delegate_t _delegate;
-			if (!GetDelegate<_delegate_t>(eBase, &_delegate))
-			{
-				// TODO: error
-			}
-			_delegate.detach();
+			m_Delegates.erase(eBase);
 		}
 
 		/**
@@ -473,6 +468,7 @@ namespace EasyDelegate
             static_assert(std::is_same<return_type, void>::value, "Trying to execute delegates with return type 'non-void'. For 'non-void' you should use 'eval' method.");
 
             auto &_delegate = _GetDelegateF<eBase>();
+            typename _Policy::scope _scope(TakeKeyIndex(eBase));
             _delegate(std::forward<Args>(args)...);
         }
 
@@ -492,9 +488,49 @@ namespace EasyDelegate
             static_assert(!std::is_same<return_type, void>::value, "Trying to evaluate delegate with return type 'void'. For 'void' you should use 'execute' method."); 
 
             auto &_delegate = _GetDelegateF<eBase>();
+            typename _Policy::scope _scope(TakeKeyIndex(eBase));
             return _delegate(std::forward<Args>(args)...);
         }
 
+        /**
+         * @brief Invokes the delegate for the specified enumerator on the library thread pool. The container should outlive the returned future.
+         * 
+         * @tparam eBase User defined enumeration key
+         * @tparam Args Templated std::tuple arguments 
+         * @param args Delegate arguments, stored by value until the call
+         * @return Future of the call result, waits for the call on destruction
+         */
+        template<_Enumerator eBase, class ...Args>
+        [[nodiscard]] inline auto invoke_async(Args&&... args)
+        {
+            using _sign_t = typename __DelegateTypeStore<TakeStoreKey<_Enumerator, eBase>()>::signature;
+            //Delegate is looked up in the calling thread, the worker only calls it
+            auto* _delegate = &_GetDelegateF<eBase>();
+            return __DelegateAsyncPool<Args...>::type::instance().submit([_delegate](auto&&... _args) -> typename __SignatureDesc<_sign_t>::return_type
+            {
+                typename _Policy::scope _scope(TakeKeyIndex(eBase));
+                return (*_delegate)(std::forward<decltype(_args)>(_args)...);
+            }, std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Looks up the delegate stored for the specified enumerator without copying it
+         *
+         * @tparam eBase User defined enumeration key
+         * @return Pointer to the stored delegate or nullptr if nothing was attached
+         */
+        template<_Enumerator eBase>
+        inline auto find() -> typename __DelegateTypeStore<TakeStoreKey<_Enumerator, eBase>()>::type*
+        {
+            using _delegate_t = typename __DelegateTypeStore<TakeStoreKey<_Enumerator, eBase>()>::type;
+            auto it = m_Delegates.find(eBase);
+            if (it == m_Delegates.end())
+            {
+                return nullptr;
+            }
+            return std::any_cast<_delegate_t>(&it->second);
+        }
+
 		private:
 		/**
 		 * @brief Commits a cast from std::any to the required delegate and returns a reference to it
@@ -503,46 +539,22 @@ namespace EasyDelegate
 		 * @return DelegateType<eEnum>::Type 
 		 */
 		template<_Enumerator eBase>
-		inline auto _GetDelegateF() -> typename __DelegateTypeStore<TakeStoreKey<_Enumerator, eBase>()>::type
+		inline auto _GetDelegateF() -> typename __DelegateTypeStore<TakeStoreKey<_Enumerator, eBase>()>::type&
 		{
-			using _delegate_t = typename __DelegateTypeStore<TakeStoreKey<_Enumerator, eBase>()>::type;
-			_delegate_t _delegate;
-			if (!GetDelegate<_delegate_t>(eBase, &_delegate))
+			auto* _delegate = find<eBase>();
+			if (!_delegate)
 			{
-				// TODO: error
+				assert(false && "Delegate was not attached.");
+				throw std::bad_function_call();
 			}
-			return _delegate;
-		}
-
-		/**
-		 * @brief Tries to cast std::any to the required delegate
-		 * 
-		 * @tparam CastType Type to be reduced to
-		 * @tparam T Output object type
-		 * @param eEnum 
-		 * @param out 
-		 */
-		template<class _CastType, class _T>
-		inline bool GetDelegate(const _Enumerator& eEnum, _T* out)
-		{
-			try
-			{
-				*out = std::any_cast<_CastType>(m_Delegates[eEnum]);
-				return true;
-			}
-			catch (const std::bad_any_cast& e)
-			{
-				assert(false && e.what());
-			}
-			out = nullptr;
-			return false;
+			return *_delegate;
 		}
 
 		std::map<_Enumerator, std::any, _Comp> m_Delegates;
 	};
 
-	template<class _Enumerator, class _Comp = __EnumeratorComp<_Enumerator>>
-	using TDelegateAny = __DelegateAny<_Enumerator, _Comp>;
+	template<class _Enumerator, class _Comp = __EnumeratorComp<_Enumerator>, class _Policy = __NoInstrumentation>
+	using TDelegateAny = __DelegateAny<_Enumerator, _Comp, _Policy>;
 }
 
 /**
@@ -554,11 +566,8 @@ namespace EasyDelegate
 
 using namespace EasyDelegate;
 
-//    An important note. You cannot use TDelegateAny and TDelegateAnyCT at the 
-//    same time due to some technical problems. The same is the case with the 
-//    enumerator. When the problem is resolved, this will be indicated in the update.
-
-// If you want use multiple enums, start new enum with higher index
+//    Keys keep the type of their enumerator, so every enumerator can start from zero
+//    and TDelegateAny can be used together with TDelegateAnyCT.
 enum class EEnumerator
 {
     EIntDelegate,
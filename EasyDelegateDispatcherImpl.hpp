@@ -0,0 +1,689 @@
+/**
+Mozilla Public License Version 2.0
+==================================
+
+Copyright (c) 2021 AdamFull && range36rus
+
+1. Definitions
+--------------
+
+1.1. "Contributor"
+    means each individual or legal entity that creates, contributes to
+    the creation of, or owns Covered Software.
+
+1.2. "Contributor Version"
+    means the combination of the Contributions of others (if any) used
+    by a Contributor and that particular Contributor's Contribution.
+
+1.3. "Contribution"
+    means Covered Software of a particular Contributor.
+
+1.4. "Covered Software"
+    means Source Code Form to which the initial Contributor has attached
+    the notice in Exhibit A, the Executable Form of such Source Code
+    Form, and Modifications of such Source Code Form, in each case
+    including portions thereof.
+
+1.5. "Incompatible With Secondary Licenses"
+    means
+
+    (a) that the initial Contributor has attached the notice described
+        in Exhibit B to the Covered Software; or
+
+    (b) that the Covered Software was made available under the terms of
+        version 1.1 or earlier of the License, but not also under the
+        terms of a Secondary License.
+
+1.6. "Executable Form"
+    means any form of the work other than Source Code Form.
+
+1.7. "Larger Work"
+    means a work that combines Covered Software with other material, in
+    a separate file or files, that is not Covered Software.
+
+1.8. "License"
+    means this document.
+
+1.9. "Licensable"
+    means having the right to grant, to the maximum extent possible,
+    whether at the time of the initial grant or subsequently, any and
+    all of the rights conveyed by this License.
+
+1.10. "Modifications"
+    means any of the following:
+
+    (a) any file in Source Code Form that results from an addition to,
+        deletion from, or modification of the contents of Covered
+        Software; or
+
+    (b) any new file in Source Code Form that contains any Covered
+        Software.
+
+1.11. "Patent Claims" of a Contributor
+    means any patent claim(s), including without limitation, method,
+    process, and apparatus claims, in any patent Licensable by such
+    Contributor that would be infringed, but for the grant of the
+    License, by the making, using, selling, offering for sale, having
+    made, import, or transfer of either its Contributions or its
+    Contributor Version.
+
+1.12. "Secondary License"
+    means either the GNU General Public License, Version 2.0, the GNU
+    Lesser General Public License, Version 2.1, the GNU Affero General
+    Public License, Version 3.0, or any later versions of those
+    licenses.
+
+1.13. "Source Code Form"
+    means the form of the work preferred for making modifications.
+
+1.14. "You" (or "Your")
+    means an individual or a legal entity exercising rights under this
+    License. For legal entities, "You" includes any entity that
+    controls, is controlled by, or is under common control with You. For
+    purposes of this definition, "control" means (a) the power, direct
+    or indirect, to cause the direction or management of such entity,
+    whether by contract or otherwise, or (b) ownership of more than
+    fifty percent (50%) of the outstanding shares or beneficial
+    ownership of such entity.
+
+2. License Grants and Conditions
+--------------------------------
+
+2.1. Grants
+
+Each Contributor hereby grants You a world-wide, royalty-free,
+non-exclusive license:
+
+(a) under intellectual property rights (other than patent or trademark)
+    Licensable by such Contributor to use, reproduce, make available,
+    modify, display, perform, distribute, and otherwise exploit its
+    Contributions, either on an unmodified basis, with Modifications, or
+    as part of a Larger Work; and
+
+(b) under Patent Claims of such Contributor to make, use, sell, offer
+    for sale, have made, import, and otherwise transfer either its
+    Contributions or its Contributor Version.
+
+2.2. Effective Date
+
+The licenses granted in Section 2.1 with respect to any Contribution
+become effective for each Contribution on the date the Contributor first
+distributes such Contribution.
+
+2.3. Limitations on Grant Scope
+
+The licenses granted in this Section 2 are the only rights granted under
+this License. No additional rights or licenses will be implied from the
+distribution or licensing of Covered Software under this License.
+Notwithstanding Section 2.1(b) above, no patent license is granted by a
+Contributor:
+
+(a) for any code that a Contributor has removed from Covered Software;
+    or
+
+(b) for infringements caused by: (i) Your and any other third party's
+    modifications of Covered Software, or (ii) the combination of its
+    Contributions with other software (except as part of its Contributor
+    Version); or
+
+(c) under Patent Claims infringed by Covered Software in the absence of
+    its Contributions.
+
+This License does not grant any rights in the trademarks, service marks,
+or logos of any Contributor (except as may be necessary to comply with
+the notice requirements in Section 3.4).
+
+2.4. Subsequent Licenses
+
+No Contributor makes additional grants as a result of Your choice to
+distribute the Covered Software under a subsequent version of this
+License (see Section 10.2) or under the terms of a Secondary License (if
+permitted under the terms of Section 3.3).
+
+2.5. Representation
+
+Each Contributor represents that the Contributor believes its
+Contributions are its original creation(s) or it has sufficient rights
+to grant the rights to its Contributions conveyed by this License.
+
+2.6. Fair Use
+
+This License is not intended to limit any rights You have under
+applicable copyright doctrines of fair use, fair dealing, or other
+equivalents.
+
+2.7. Conditions
+
+Sections 3.1, 3.2, 3.3, and 3.4 are conditions of the licenses granted
+in Section 2.1.
+
+3. Responsibilities
+-------------------
+
+3.1. Distribution of Source Form
+
+All distribution of Covered Software in Source Code Form, including any
+Modifications that You create or to which You contribute, must be under
+the terms of this License. You must inform recipients that the Source
+Code Form of the Covered Software is governed by the terms of this
+License, and how they can obtain a copy of this License. You may not
+attempt to alter or restrict the recipients' rights in the Source Code
+Form.
+
+3.2. Distribution of Executable Form
+
+If You distribute Covered Software in Executable Form then:
+
+(a) such Covered Software must also be made available in Source Code
+    Form, as described in Section 3.1, and You must inform recipients of
+    the Executable Form how they can obtain a copy of such Source Code
+    Form by reasonable means in a timely manner, at a charge no more
+    than the cost of distribution to the recipient; and
+
+(b) You may distribute such Executable Form under the terms of this
+    License, or sublicense it under different terms, provided that the
+    license for the Executable Form does not attempt to limit or alter
+    the recipients' rights in the Source Code Form under this License.
+
+3.3. Distribution of a Larger Work
+
+You may create and distribute a Larger Work under terms of Your choice,
+provided that You also comply with the requirements of this License for
+the Covered Software. If the Larger Work is a combination of Covered
+Software with a work governed by one or more Secondary Licenses, and the
+Covered Software is not Incompatible With Secondary Licenses, this
+License permits You to additionally distribute such Covered Software
+under the terms of such Secondary License(s), so that the recipient of
+the Larger Work may, at their option, further distribute the Covered
+Software under the terms of either this License or such Secondary
+License(s).
+
+3.4. Notices
+
+You may not remove or alter the substance of any license notices
+(including copyright notices, patent notices, disclaimers of warranty,
+or limitations of liability) contained within the Source Code Form of
+the Covered Software, except that You may alter any license notices to
+the extent required to remedy known factual inaccuracies.
+
+3.5. Application of Additional Terms
+
+You may choose to offer, and to charge a fee for, warranty, support,
+indemnity or liability obligations to one or more recipients of Covered
+Software. However, You may do so only on Your own behalf, and not on
+behalf of any Contributor. You must make it absolutely clear that any
+such warranty, support, indemnity, or liability obligation is offered by
+You alone, and You hereby agree to indemnify every Contributor for any
+liability incurred by such Contributor as a result of warranty, support,
+indemnity or liability terms You offer. You may include additional
+disclaimers of warranty and limitations of liability specific to any
+jurisdiction.
+
+4. Inability to Comply Due to Statute or Regulation
+---------------------------------------------------
+
+If it is impossible for You to comply with any of the terms of this
+License with respect to some or all of the Covered Software due to
+statute, judicial order, or regulation then You must: (a) comply with
+the terms of this License to the maximum extent possible; and (b)
+describe the limitations and the code they affect. Such description must
+be placed in a text file included with all distributions of the Covered
+Software under this License. Except to the extent prohibited by statute
+or regulation, such description must be sufficiently detailed for a
+recipient of ordinary skill to be able to understand it.
+
+5. Termination
+--------------
+
+5.1. The rights granted under this License will terminate automatically
+if You fail to comply with any of its terms. However, if You become
+compliant, then the rights granted under this License from a particular
+Contributor are reinstated (a) provisionally, unless and until such
+Contributor explicitly and finally terminates Your grants, and (b) on an
+ongoing basis, if such Contributor fails to notify You of the
+non-compliance by some reasonable means prior to 60 days after You have
+come back into compliance. Moreover, Your grants from a particular
+Contributor are reinstated on an ongoing basis if such Contributor
+notifies You of the non-compliance by some reasonable means, this is the
+first time You have received notice of non-compliance with this License
+from such Contributor, and You become compliant prior to 30 days after
+Your receipt of the notice.
+
+5.2. If You initiate litigation against any entity by asserting a patent
+infringement claim (excluding declaratory judgment actions,
+counter-claims, and cross-claims) alleging that a Contributor Version
+directly or indirectly infringes any patent, then the rights granted to
+You by any and all Contributors for the Covered Software under Section
+2.1 of this License shall terminate.
+
+5.3. In the event of termination under Sections 5.1 or 5.2 above, all
+end user license agreements (excluding distributors and resellers) which
+have been validly granted by You or Your distributors under this License
+prior to termination shall survive termination.
+
+************************************************************************
+*                                                                      *
+*  6. Disclaimer of Warranty                                           *
+*  -------------------------                                           *
+*                                                                      *
+*  Covered Software is provided under this License on an "as is"       *
+*  basis, without warranty of any kind, either expressed, implied, or  *
+*  statutory, including, without limitation, warranties that the       *
+*  Covered Software is free of defects, merchantable, fit for a        *
+*  particular purpose or non-infringing. The entire risk as to the     *
+*  quality and performance of the Covered Software is with You.        *
+*  Should any Covered Software prove defective in any respect, You     *
+*  (not any Contributor) assume the cost of any necessary servicing,   *
+*  repair, or correction. This disclaimer of warranty constitutes an   *
+*  essential part of this License. No use of any Covered Software is   *
+*  authorized under this License except under this disclaimer.         *
+*                                                                      *
+************************************************************************
+
+************************************************************************
+*                                                                      *
+*  7. Limitation of Liability                                          *
+*  --------------------------                                          *
+*                                                                      *
+*  Under no circumstances and under no legal theory, whether tort      *
+*  (including negligence), contract, or otherwise, shall any           *
+*  Contributor, or anyone who distributes Covered Software as          *
+*  permitted above, be liable to You for any direct, indirect,         *
+*  special, incidental, or consequential damages of any character      *
+*  including, without limitation, damages for lost profits, loss of    *
+*  goodwill, work stoppage, computer failure or malfunction, or any    *
+*  and all other commercial damages or losses, even if such party      *
+*  shall have been informed of the possibility of such damages. This   *
+*  limitation of liability shall not apply to liability for death or   *
+*  personal injury resulting from such party's negligence to the       *
+*  extent applicable law prohibits such limitation. Some               *
+*  jurisdictions do not allow the exclusion or limitation of           *
+*  incidental or consequential damages, so this exclusion and          *
+*  limitation may not apply to You.                                    *
+*                                                                      *
+************************************************************************
+
+8. Litigation
+-------------
+
+Any litigation relating to this License may be brought only in the
+courts of a jurisdiction where the defendant maintains its principal
+place of business and such litigation shall be governed by laws of that
+jurisdiction, without reference to its conflict-of-law provisions.
+Nothing in this Section shall prevent a party's ability to bring
+cross-claims or counter-claims.
+
+9. Miscellaneous
+----------------
+
+This License represents the complete agreement concerning the subject
+matter hereof. If any provision of this License is held to be
+unenforceable, such provision shall be reformed only to the extent
+necessary to make it enforceable. Any law or regulation which provides
+that the language of a contract shall be construed against the drafter
+shall not be used to construe this License against a Contributor.
+
+10. Versions of the License
+---------------------------
+
+10.1. New Versions
+
+Mozilla Foundation is the license steward. Except as provided in Section
+10.3, no one other than the license steward has the right to modify or
+publish new versions of this License. Each version will be given a
+distinguishing version number.
+
+10.2. Effect of New Versions
+
+You may distribute the Covered Software under the terms of the version
+of the License under which You originally received the Covered Software,
+or under the terms of any subsequent version published by the license
+steward.
+
+10.3. Modified Versions
+
+If you create software not governed by this License, and you want to
+create a new license for such software, you may create and use a
+modified version of this License if you rename the license and remove
+any references to the name of the license steward (except to note that
+such modified license differs from this License).
+
+10.4. Distributing Source Code Form that is Incompatible With Secondary
+Licenses
+
+If You choose to distribute Source Code Form that is Incompatible With
+Secondary Licenses under the terms of this version of the License, the
+notice described in Exhibit B of this License must be attached.
+
+Exhibit A - Source Code Form License Notice
+-------------------------------------------
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular
+file, then You may include the notice in a location (such as a LICENSE
+file in a relevant directory) where a recipient would be likely to look
+for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+Exhibit B - "Incompatible With Secondary Licenses" Notice
+---------------------------------------------------------
+
+  This Source Code Form is "Incompatible With Secondary Licenses", as
+  defined by the Mozilla Public License, v. 2.0.
+ */
+
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <map>
+#include "EasyDelegateImpl.hpp"
+#include "EasyDelegateAnyImpl.hpp"
+
+namespace EasyDelegate
+{
+    //Largest span between the lowest and the highest key of a dispatcher, the jump table has one entry per value of the span
+    constexpr int64_t DelegateDispatchKeys = 4096;
+
+    /**
+     * @brief Reads one argument from the packed payload directly into the value passed to the delegate
+     * 
+     * @tparam _Arg Decayed argument type
+     * @param data Pointer to the first byte of the argument inside the payload
+     * @return _Arg 
+     */
+    template<class _Arg>
+    [[nodiscard]] inline _Arg __ReadPackedArg(const std::byte* data) noexcept
+    {
+        static_assert(std::is_trivially_copyable<_Arg>::value, "Only trivially copyable arguments can be decoded from a byte payload.");
+        static_assert(std::is_default_constructible<_Arg>::value, "Decoded arguments should be default constructible.");
+        _Arg value;
+        std::memcpy(&value, data, sizeof(_Arg));
+        return value;
+    }
+
+    /**
+     * @brief A helper template that describes the packed layout of the argument list taken from __SignatureDesc
+     * 
+     * @tparam _ArgumentTuple std::tuple of the signature argument types
+     */
+    template<class _ArgumentTuple>
+    struct __PayloadDecoder;
+
+    /**
+     * @brief Specialization for the argument tuple. Arguments are stored back to back without padding.
+     * 
+     * @tparam Args 
+     */
+    template<class ...Args>
+    struct __PayloadDecoder<std::tuple<Args...>>
+    {
+        static constexpr std::size_t size = (std::size_t{0} + ... + sizeof(std::decay_t<Args>));
+
+        /**
+         * @brief Calls the delegate with the arguments read from the payload
+         * 
+         * @tparam _Delegate Delegate type
+         * @param _delegate Delegate to call
+         * @param data Payload with at least 'size' bytes
+         */
+        template<class _Delegate>
+        static inline void invoke(_Delegate& _delegate, const std::byte* data)
+        {
+            invoke_impl(_delegate, data, std::index_sequence_for<Args...>{});
+        }
+
+        /**
+         * @brief Writes the arguments into the packed payload in the same layout the decoder expects
+         * 
+         * @param out Output buffer with at least 'size' bytes
+         * @param args Arguments to pack
+         * @return std::size_t Count of written bytes
+         */
+        static inline std::size_t encode(std::byte* out, const std::decay_t<Args>&... args) noexcept
+        {
+            std::size_t offset{0};
+            ((std::memcpy(out + offset, &args, sizeof(args)), offset += sizeof(args)), ...);
+            return offset;
+        }
+
+    private:
+        static constexpr std::array<std::size_t, sizeof...(Args)> make_offsets() noexcept
+        {
+            std::array<std::size_t, sizeof...(Args)> offsets{};
+            std::size_t sizes[] = {sizeof(std::decay_t<Args>)..., 0};
+            std::size_t offset{0};
+            for (std::size_t i = 0; i < sizeof...(Args); ++i)
+            {
+                offsets[i] = offset;
+                offset += sizes[i];
+            }
+            return offsets;
+        }
+
+        template<class _Delegate, std::size_t ...Indices>
+        static inline void invoke_impl(_Delegate& _delegate, [[maybe_unused]] const std::byte* data, std::index_sequence<Indices...>)
+        {
+            static_assert(((!std::is_lvalue_reference<Args>::value || std::is_const<std::remove_reference_t<Args>>::value) && ...), 
+            "Delegates with non-const lvalue reference arguments cannot be called from a payload.");
+            [[maybe_unused]] constexpr auto offsets = make_offsets();
+            _delegate(__ReadPackedArg<std::decay_t<Args>>(data + offsets[Indices])...);
+        }
+    };
+
+    /**
+     * @brief Decodes serialized (key, payload) messages and calls the delegate attached to TDelegateAny for that key.
+     * The decoder of every key is generated from the signature declared with DeclareDelegateFuncRuntime, the runtime key
+     * is translated to the decoder through a jump table built at compile time.
+     * 
+     * @tparam _Enumerator Enumerator class
+     * @tparam _Comp Comparator of the TDelegateAny container
+     * @tparam _Policy Instrumentation policy of the TDelegateAny container
+     * @tparam eKeys Keys that can be dispatched
+     */
+    template<class _Enumerator, class _Comp, class _Policy, _Enumerator... eKeys>
+    class __DelegateDispatcher
+    {
+        static_assert(sizeof...(eKeys) > 0, "Dispatcher requires at least one key.");
+
+        using container_t = __DelegateAny<_Enumerator, _Comp, _Policy>;
+        using thunk_t = bool (*)(container_t&, const std::byte*, std::size_t);
+
+        template<_Enumerator eBase>
+        using decoder_t = __PayloadDecoder<typename __SignatureDesc<typename __DelegateTypeStore<TakeStoreKey<_Enumerator, eBase>()>::signature>::argument_type>;
+
+    public:
+        /**
+         * @brief Construct a new dispatcher over existing delegate container
+         * 
+         * @param delegates Container with attached delegates. Should live longer than the dispatcher.
+         */
+        explicit __DelegateDispatcher(container_t& delegates) noexcept : m_Delegates(delegates) {}
+
+        /**
+         * @brief Decodes the payload and calls the delegate attached to the key
+         * 
+         * @param eKey Runtime key of the message
+         * @param data Pointer to the payload
+         * @param size Payload size in bytes
+         * @return true if the delegate was found and called
+         */
+        inline bool dispatch(_Enumerator eKey, const void* data, std::size_t size)
+        {
+            //Keys below the lowest declared one are negative here and rejected with the ones above the table
+            const int64_t offset = _KeyValue(eKey) - _MinKey;
+            if (offset < 0 || static_cast<uint64_t>(offset) >= m_Table.size() || !m_Table[static_cast<std::size_t>(offset)])
+            {
+                return false;
+            }
+            return m_Table[static_cast<std::size_t>(offset)](m_Delegates, static_cast<const std::byte*>(data), size);
+        }
+
+        /**
+         * @brief Decodes the payload stored in contiguous container and calls the delegate attached to the key
+         * 
+         * @tparam _Buffer Contiguous container type (std::vector, std::array, std::string...)
+         * @param eKey Runtime key of the message
+         * @param buffer Payload container
+         * @return true if the delegate was found and called
+         */
+        template<class _Buffer>
+        inline bool dispatch(_Enumerator eKey, const _Buffer& buffer)
+        {
+            return dispatch(eKey, std::data(buffer), std::size(buffer) * sizeof(*std::data(buffer)));
+        }
+
+        /**
+         * @brief Returns the payload size expected for the key
+         * 
+         * @tparam eBase User defined enumeration key
+         * @return constexpr std::size_t 
+         */
+        template<_Enumerator eBase>
+        [[nodiscard]] static constexpr std::size_t payload_size() noexcept
+        {
+            return decoder_t<eBase>::size;
+        }
+
+        /**
+         * @brief Packs arguments for the key into the payload layout expected by dispatch
+         * 
+         * @tparam eBase User defined enumeration key
+         * @tparam Args Argument types
+         * @param out Output buffer with at least payload_size<eBase>() bytes
+         * @param args Arguments to pack
+         * @return std::size_t Count of written bytes
+         */
+        template<_Enumerator eBase, class ...Args>
+        static inline std::size_t encode(void* out, Args&&... args) noexcept
+        {
+            return decoder_t<eBase>::encode(static_cast<std::byte*>(out), std::forward<Args>(args)...);
+        }
+
+    private:
+        template<_Enumerator eBase>
+        static bool _Decode(container_t& delegates, const std::byte* data, std::size_t size)
+        {
+            auto* _delegate = delegates.template find<eBase>();
+            if (!_delegate || !*_delegate || size < decoder_t<eBase>::size)
+            {
+                return false;
+            }
+            typename _Policy::scope _scope(TakeKeyIndex(eBase));
+            decoder_t<eBase>::invoke(*_delegate, data);
+            return true;
+        }
+
+        //Signed value of the key, so negative keys stay below the positive ones
+        static constexpr int64_t _KeyValue(_Enumerator eKey) noexcept
+        {
+            return static_cast<int64_t>(static_cast<std::underlying_type_t<_Enumerator>>(eKey));
+        }
+
+        static constexpr int64_t _MinKey = std::min({_KeyValue(eKeys)...});
+        static constexpr int64_t _MaxKey = std::max({_KeyValue(eKeys)...});
+        static_assert(_MaxKey - _MinKey < DelegateDispatchKeys, "Keys of the dispatcher should be dense, their span is limited by DelegateDispatchKeys.");
+        static constexpr std::size_t _TableSize = static_cast<std::size_t>(_MaxKey - _MinKey + 1);
+
+        static constexpr std::array<thunk_t, _TableSize> _MakeTable() noexcept
+        {
+            std::array<thunk_t, _TableSize> table{};
+            ((table[static_cast<std::size_t>(_KeyValue(eKeys) - _MinKey)] = &_Decode<eKeys>), ...);
+            return table;
+        }
+
+        static constexpr std::array<thunk_t, _TableSize> m_Table = _MakeTable();
+
+        container_t& m_Delegates;
+    };
+
+    template<class _Enumerator, _Enumerator... eKeys>
+    using TDelegateDispatcher = __DelegateDispatcher<_Enumerator, __EnumeratorComp<_Enumerator>, __NoInstrumentation, eKeys...>;
+}
+
+/**
+ * @example MessageDispatcherExample
+ * 
+ * @code
+#include <iostream>
+#include <vector>
+#include "EasyDelegate.hpp"
+
+using namespace EasyDelegate;
+
+enum class EOpcode
+{
+    EMove,
+    EChat,
+    EPing
+};
+
+struct FVector
+{
+    float x, y, z;
+};
+
+//This declarations should be in cpp file
+DeclareDelegateFuncRuntime(EOpcode, EOpcode::EMove, void(uint32_t, const FVector&))
+DeclareDelegateFuncRuntime(EOpcode, EOpcode::EChat, void(uint32_t, char))
+DeclareDelegateFuncRuntime(EOpcode, EOpcode::EPing, void())
+
+//Stand-in for the network layer, stores (opcode, payload) pairs
+struct FMessage
+{
+    EOpcode opcode;
+    std::vector<std::byte> payload;
+};
+
+void move(uint32_t id, const FVector& pos)
+{
+    std::cout << "Move " << id << ": " << pos.x << " " << pos.y << " " << pos.z << std::endl;
+}
+
+int main()
+{
+    TDelegateAny<EOpcode> _handlers;
+    _handlers.attach<EOpcode::EMove>(&move);
+    _handlers.attach<EOpcode::EChat>([](uint32_t id, char c)
+    {
+        std::cout << "Chat " << id << ": " << c << std::endl;
+    });
+
+    //Declare dispatcher for the keys that can arrive from the network
+    using dispatcher_t = TDelegateDispatcher<EOpcode, EOpcode::EMove, EOpcode::EChat, EOpcode::EPing>;
+    dispatcher_t _dispatcher(_handlers);
+
+    //Packing messages the same way as the sender does
+    std::vector<FMessage> _queue;
+    FMessage _move{EOpcode::EMove, std::vector<std::byte>(dispatcher_t::payload_size<EOpcode::EMove>())};
+    dispatcher_t::encode<EOpcode::EMove>(_move.payload.data(), 7u, FVector{1.f, 2.f, 3.f});
+    _queue.push_back(_move);
+
+    FMessage _chat{EOpcode::EChat, std::vector<std::byte>(dispatcher_t::payload_size<EOpcode::EChat>())};
+    dispatcher_t::encode<EOpcode::EChat>(_chat.payload.data(), 7u, 'a');
+    _queue.push_back(_chat);
+
+    //Nothing attached to ping, dispatch returns false
+    _queue.push_back(FMessage{EOpcode::EPing, {}});
+
+    int handled{0};
+    for (auto &_message : _queue)
+    {
+        handled += _dispatcher.dispatch(_message.opcode, _message.payload) ? 1 : 0;
+    }
+
+    std::cout << handled << std::endl;
+
+    return handled == 2 ? 0 : 1;
+}
+
+ *   @endcode
+ * 
+ */
\ No newline at end of file
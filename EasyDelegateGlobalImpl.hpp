@@ -0,0 +1,908 @@
+/**
+Mozilla Public License Version 2.0
+==================================
+
+Copyright (c) 2021 AdamFull && range36rus
+
+1. Definitions
+--------------
+
+1.1. "Contributor"
+    means each individual or legal entity that creates, contributes to
+    the creation of, or owns Covered Software.
+
+1.2. "Contributor Version"
+    means the combination of the Contributions of others (if any) used
+    by a Contributor and that particular Contributor's Contribution.
+
+1.3. "Contribution"
+    means Covered Software of a particular Contributor.
+
+1.4. "Covered Software"
+    means Source Code Form to which the initial Contributor has attached
+    the notice in Exhibit A, the Executable Form of such Source Code
+    Form, and Modifications of such Source Code Form, in each case
+    including portions thereof.
+
+1.5. "Incompatible With Secondary Licenses"
+    means
+
+    (a) that the initial Contributor has attached the notice described
+        in Exhibit B to the Covered Software; or
+
+    (b) that the Covered Software was made available under the terms of
+        version 1.1 or earlier of the License, but not also under the
+        terms of a Secondary License.
+
+1.6. "Executable Form"
+    means any form of the work other than Source Code Form.
+
+1.7. "Larger Work"
+    means a work that combines Covered Software with other material, in
+    a separate file or files, that is not Covered Software.
+
+1.8. "License"
+    means this document.
+
+1.9. "Licensable"
+    means having the right to grant, to the maximum extent possible,
+    whether at the time of the initial grant or subsequently, any and
+    all of the rights conveyed by this License.
+
+1.10. "Modifications"
+    means any of the following:
+
+    (a) any file in Source Code Form that results from an addition to,
+        deletion from, or modification of the contents of Covered
+        Software; or
+
+    (b) any new file in Source Code Form that contains any Covered
+        Software.
+
+1.11. "Patent Claims" of a Contributor
+    means any patent claim(s), including without limitation, method,
+    process, and apparatus claims, in any patent Licensable by such
+    Contributor that would be infringed, but for the grant of the
+    License, by the making, using, selling, offering for sale, having
+    made, import, or transfer of either its Contributions or its
+    Contributor Version.
+
+1.12. "Secondary License"
+    means either the GNU General Public License, Version 2.0, the GNU
+    Lesser General Public License, Version 2.1, the GNU Affero General
+    Public License, Version 3.0, or any later versions of those
+    licenses.
+
+1.13. "Source Code Form"
+    means the form of the work preferred for making modifications.
+
+1.14. "You" (or "Your")
+    means an individual or a legal entity exercising rights under this
+    License. For legal entities, "You" includes any entity that
+    controls, is controlled by, or is under common control with You. For
+    purposes of this definition, "control" means (a) the power, direct
+    or indirect, to cause the direction or management of such entity,
+    whether by contract or otherwise, or (b) ownership of more than
+    fifty percent (50%) of the outstanding shares or beneficial
+    ownership of such entity.
+
+2. License Grants and Conditions
+--------------------------------
+
+2.1. Grants
+
+Each Contributor hereby grants You a world-wide, royalty-free,
+non-exclusive license:
+
+(a) under intellectual property rights (other than patent or trademark)
+    Licensable by such Contributor to use, reproduce, make available,
+    modify, display, perform, distribute, and otherwise exploit its
+    Contributions, either on an unmodified basis, with Modifications, or
+    as part of a Larger Work; and
+
+(b) under Patent Claims of such Contributor to make, use, sell, offer
+    for sale, have made, import, and otherwise transfer either its
+    Contributions or its Contributor Version.
+
+2.2. Effective Date
+
+The licenses granted in Section 2.1 with respect to any Contribution
+become effective for each Contribution on the date the Contributor first
+distributes such Contribution.
+
+2.3. Limitations on Grant Scope
+
+The licenses granted in this Section 2 are the only rights granted under
+this License. No additional rights or licenses will be implied from the
+distribution or licensing of Covered Software under this License.
+Notwithstanding Section 2.1(b) above, no patent license is granted by a
+Contributor:
+
+(a) for any code that a Contributor has removed from Covered Software;
+    or
+
+(b) for infringements caused by: (i) Your and any other third party's
+    modifications of Covered Software, or (ii) the combination of its
+    Contributions with other software (except as part of its Contributor
+    Version); or
+
+(c) under Patent Claims infringed by Covered Software in the absence of
+    its Contributions.
+
+This License does not grant any rights in the trademarks, service marks,
+or logos of any Contributor (except as may be necessary to comply with
+the notice requirements in Section 3.4).
+
+2.4. Subsequent Licenses
+
+No Contributor makes additional grants as a result of Your choice to
+distribute the Covered Software under a subsequent version of this
+License (see Section 10.2) or under the terms of a Secondary License (if
+permitted under the terms of Section 3.3).
+
+2.5. Representation
+
+Each Contributor represents that the Contributor believes its
+Contributions are its original creation(s) or it has sufficient rights
+to grant the rights to its Contributions conveyed by this License.
+
+2.6. Fair Use
+
+This License is not intended to limit any rights You have under
+applicable copyright doctrines of fair use, fair dealing, or other
+equivalents.
+
+2.7. Conditions
+
+Sections 3.1, 3.2, 3.3, and 3.4 are conditions of the licenses granted
+in Section 2.1.
+
+3. Responsibilities
+-------------------
+
+3.1. Distribution of Source Form
+
+All distribution of Covered Software in Source Code Form, including any
+Modifications that You create or to which You contribute, must be under
+the terms of this License. You must inform recipients that the Source
+Code Form of the Covered Software is governed by the terms of this
+License, and how they can obtain a copy of this License. You may not
+attempt to alter or restrict the recipients' rights in the Source Code
+Form.
+
+3.2. Distribution of Executable Form
+
+If You distribute Covered Software in Executable Form then:
+
+(a) such Covered Software must also be made available in Source Code
+    Form, as described in Section 3.1, and You must inform recipients of
+    the Executable Form how they can obtain a copy of such Source Code
+    Form by reasonable means in a timely manner, at a charge no more
+    than the cost of distribution to the recipient; and
+
+(b) You may distribute such Executable Form under the terms of this
+    License, or sublicense it under different terms, provided that the
+    license for the Executable Form does not attempt to limit or alter
+    the recipients' rights in the Source Code Form under this License.
+
+3.3. Distribution of a Larger Work
+
+You may create and distribute a Larger Work under terms of Your choice,
+provided that You also comply with the requirements of this License for
+the Covered Software. If the Larger Work is a combination of Covered
+Software with a work governed by one or more Secondary Licenses, and the
+Covered Software is not Incompatible With Secondary Licenses, this
+License permits You to additionally distribute such Covered Software
+under the terms of such Secondary License(s), so that the recipient of
+the Larger Work may, at their option, further distribute the Covered
+Software under the terms of either this License or such Secondary
+License(s).
+
+3.4. Notices
+
+You may not remove or alter the substance of any license notices
+(including copyright notices, patent notices, disclaimers of warranty,
+or limitations of liability) contained within the Source Code Form of
+the Covered Software, except that You may alter any license notices to
+the extent required to remedy known factual inaccuracies.
+
+3.5. Application of Additional Terms
+
+You may choose to offer, and to charge a fee for, warranty, support,
+indemnity or liability obligations to one or more recipients of Covered
+Software. However, You may do so only on Your own behalf, and not on
+behalf of any Contributor. You must make it absolutely clear that any
+such warranty, support, indemnity, or liability obligation is offered by
+You alone, and You hereby agree to indemnify every Contributor for any
+liability incurred by such Contributor as a result of warranty, support,
+indemnity or liability terms You offer. You may include additional
+disclaimers of warranty and limitations of liability specific to any
+jurisdiction.
+
+4. Inability to Comply Due to Statute or Regulation
+---------------------------------------------------
+
+If it is impossible for You to comply with any of the terms of this
+License with respect to some or all of the Covered Software due to
+statute, judicial order, or regulation then You must: (a) comply with
+the terms of this License to the maximum extent possible; and (b)
+describe the limitations and the code they affect. Such description must
+be placed in a text file included with all distributions of the Covered
+Software under this License. Except to the extent prohibited by statute
+or regulation, such description must be sufficiently detailed for a
+recipient of ordinary skill to be able to understand it.
+
+5. Termination
+--------------
+
+5.1. The rights granted under this License will terminate automatically
+if You fail to comply with any of its terms. However, if You become
+compliant, then the rights granted under this License from a particular
+Contributor are reinstated (a) provisionally, unless and until such
+Contributor explicitly and finally terminates Your grants, and (b) on an
+ongoing basis, if such Contributor fails to notify You of the
+non-compliance by some reasonable means prior to 60 days after You have
+come back into compliance. Moreover, Your grants from a particular
+Contributor are reinstated on an ongoing basis if such Contributor
+notifies You of the non-compliance by some reasonable means, this is the
+first time You have received notice of non-compliance with this License
+from such Contributor, and You become compliant prior to 30 days after
+Your receipt of the notice.
+
+5.2. If You initiate litigation against any entity by asserting a patent
+infringement claim (excluding declaratory judgment actions,
+counter-claims, and cross-claims) alleging that a Contributor Version
+directly or indirectly infringes any patent, then the rights granted to
+You by any and all Contributors for the Covered Software under Section
+2.1 of this License shall terminate.
+
+5.3. In the event of termination under Sections 5.1 or 5.2 above, all
+end user license agreements (excluding distributors and resellers) which
+have been validly granted by You or Your distributors under this License
+prior to termination shall survive termination.
+
+************************************************************************
+*                                                                      *
+*  6. Disclaimer of Warranty                                           *
+*  -------------------------                                           *
+*                                                                      *
+*  Covered Software is provided under this License on an "as is"       *
+*  basis, without warranty of any kind, either expressed, implied, or  *
+*  statutory, including, without limitation, warranties that the       *
+*  Covered Software is free of defects, merchantable, fit for a        *
+*  particular purpose or non-infringing. The entire risk as to the     *
+*  quality and performance of the Covered Software is with You.        *
+*  Should any Covered Software prove defective in any respect, You     *
+*  (not any Contributor) assume the cost of any necessary servicing,   *
+*  repair, or correction. This disclaimer of warranty constitutes an   *
+*  essential part of this License. No use of any Covered Software is   *
+*  authorized under this License except under this disclaimer.         *
+*                                                                      *
+************************************************************************
+
+************************************************************************
+*                                                                      *
+*  7. Limitation of Liability                                          *
+*  --------------------------                                          *
+*                                                                      *
+*  Under no circumstances and under no legal theory, whether tort      *
+*  (including negligence), contract, or otherwise, shall any           *
+*  Contributor, or anyone who distributes Covered Software as          *
+*  permitted above, be liable to You for any direct, indirect,         *
+*  special, incidental, or consequential damages of any character      *
+*  including, without limitation, damages for lost profits, loss of    *
+*  goodwill, work stoppage, computer failure or malfunction, or any    *
+*  and all other commercial damages or losses, even if such party      *
+*  shall have been informed of the possibility of such damages. This   *
+*  limitation of liability shall not apply to liability for death or   *
+*  personal injury resulting from such party's negligence to the       *
+*  extent applicable law prohibits such limitation. Some               *
+*  jurisdictions do not allow the exclusion or limitation of           *
+*  incidental or consequential damages, so this exclusion and          *
+*  limitation may not apply to You.                                    *
+*                                                                      *
+************************************************************************
+
+8. Litigation
+-------------
+
+Any litigation relating to this License may be brought only in the
+courts of a jurisdiction where the defendant maintains its principal
+place of business and such litigation shall be governed by laws of that
+jurisdiction, without reference to its conflict-of-law provisions.
+Nothing in this Section shall prevent a party's ability to bring
+cross-claims or counter-claims.
+
+9. Miscellaneous
+----------------
+
+This License represents the complete agreement concerning the subject
+matter hereof. If any provision of this License is held to be
+unenforceable, such provision shall be reformed only to the extent
+necessary to make it enforceable. Any law or regulation which provides
+that the language of a contract shall be construed against the drafter
+shall not be used to construe this License against a Contributor.
+
+10. Versions of the License
+---------------------------
+
+10.1. New Versions
+
+Mozilla Foundation is the license steward. Except as provided in Section
+10.3, no one other than the license steward has the right to modify or
+publish new versions of this License. Each version will be given a
+distinguishing version number.
+
+10.2. Effect of New Versions
+
+You may distribute the Covered Software under the terms of the version
+of the License under which You originally received the Covered Software,
+or under the terms of any subsequent version published by the license
+steward.
+
+10.3. Modified Versions
+
+If you create software not governed by this License, and you want to
+create a new license for such software, you may create and use a
+modified version of this License if you rename the license and remove
+any references to the name of the license steward (except to note that
+such modified license differs from this License).
+
+10.4. Distributing Source Code Form that is Incompatible With Secondary
+Licenses
+
+If You choose to distribute Source Code Form that is Incompatible With
+Secondary Licenses under the terms of this version of the License, the
+notice described in Exhibit B of this License must be attached.
+
+Exhibit A - Source Code Form License Notice
+-------------------------------------------
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular
+file, then You may include the notice in a location (such as a LICENSE
+file in a relevant directory) where a recipient would be likely to look
+for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+Exhibit B - "Incompatible With Secondary Licenses" Notice
+---------------------------------------------------------
+
+  This Source Code Form is "Incompatible With Secondary Licenses", as
+  defined by the Mozilla Public License, v. 2.0.
+ */
+
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <thread>
+#include "EasyDelegateGlobalTemplates.hpp"
+
+namespace EasyDelegate
+{
+    template <class _Signature>
+    class __DelegateGlobal;
+
+    /**
+     * @brief Heap record of a global delegate that was replaced by a handler. It can't wait for the grace period: 
+     * readers of the record may be handlers of other threads that wait for this thread's delegates in turn.
+     * 
+     */
+    struct __DelegateGlobalRetired
+    {
+        //Waits for the readers of the owner and destroys the record
+        void (*reclaim)(const __DelegateGlobalRetired *) noexcept;
+        mutable const __DelegateGlobalRetired *next;
+        mutable const void *owner;
+    };
+
+    /**
+     * @brief Read guards of all global delegates on the thread. Records retired inside a handler are kept until the outermost 
+     * guard exits, the thread is not a reader of any global delegate then, so its grace periods can't wait for each other.
+     * 
+     */
+    struct __DelegateGlobalReaders
+    {
+        static inline void enter() noexcept
+        {
+            ++t_Depth;
+        }
+
+        static inline void leave() noexcept
+        {
+            if (--t_Depth == 0)
+            {
+                while (const __DelegateGlobalRetired *_retired = t_Retired)
+                {
+                    t_Retired = _retired->next;
+                    _retired->reclaim(_retired);
+                }
+            }
+        }
+
+        //Returns false when the caller is not inside a handler and should release the record itself
+        static inline bool defer(const __DelegateGlobalRetired *_retired) noexcept
+        {
+            if (t_Depth == 0)
+            {
+                return false;
+            }
+            _retired->next = t_Retired;
+            t_Retired = _retired;
+            return true;
+        }
+
+        static inline thread_local uint32_t t_Depth{0};
+        static inline thread_local const __DelegateGlobalRetired *t_Retired{nullptr};
+    };
+
+    /**
+     * @brief Delegate for global stores. It is constant-initialized and trivially destructible, so declaring 
+     * thousands of them costs nothing at startup and registers nothing at exit.
+     * 
+     * The binding can be swapped while other threads are calling the delegate, readers never block:
+     *  - functions known at compile time (attach<&func>()) are bound through a static record, 
+     *    rebinding is a single pointer store and the call is a single pointer load;
+     *  - function pointers, class methods and small trivially copyable callables are stored inline and never allocate, 
+     *    readers copy them out under a sequence counter and retry if a writer was swapping them;
+     *  - other callables are moved to a heap record that is published atomically and released 
+     *    after all readers that could see it have left (two-phase reader counters, RCU style).
+     * Writers are serialized with each other only while swapping the binding. Writers called from a handler of any global 
+     * delegate never wait for readers: the replaced heap record is released when the outermost call on that thread returns, 
+     * so handlers can rebind their own delegates and each other's from different threads. 
+     * Heap records still attached at exit are not released.
+     * 
+     * @tparam _ReturnType 
+     * @tparam Args 
+     */
+    template <class _ReturnType, class... Args>
+    class __DelegateGlobal<_ReturnType(Args...)>
+    {
+        struct binding_t : __DelegateGlobalRetired
+        {
+            _ReturnType (*stub)(const binding_t *, Args...);
+            void (*destroy)(const binding_t *);
+        };
+
+        template <class _Function>
+        struct __SharedBinding : binding_t
+        {
+            mutable _Function function;
+        };
+
+        using inline_stub_t = _ReturnType (*)(const void *, Args...);
+
+        //Enough for an object pointer together with a pointer to member function
+        static constexpr std::size_t s_InlineWords = 3;
+
+        template <class _Function>
+        static constexpr bool _IsInline = std::is_trivially_copyable<_Function>::value && sizeof(_Function) <= s_InlineWords * sizeof(uintptr_t) && 
+            alignof(_Function) <= alignof(uintptr_t);
+
+        struct __InlineCopy
+        {
+            inline_stub_t stub;
+            uintptr_t storage[s_InlineWords];
+        };
+
+    public:
+        /**
+         * @brief Construct an empty delegate. Constant initialization.
+         * 
+         */
+        constexpr __DelegateGlobal() noexcept = default;
+
+        __DelegateGlobal(const __DelegateGlobal &) = delete;
+        __DelegateGlobal &operator=(const __DelegateGlobal &) = delete;
+
+        /**
+         * @brief Creates a delegate bound to the static function at compile time
+         * 
+         * @tparam _Function Static function pointer
+         * @return constexpr __DelegateGlobal 
+         */
+        template <auto _Function>
+        [[nodiscard]] static constexpr __DelegateGlobal make() noexcept
+        {
+            return __DelegateGlobal(&_FunctionBinding<_Function>);
+        }
+
+        /**
+         * @brief Binds the static function known at compile time. Lock-free and never allocates.
+         * 
+         * @tparam _Function Static function pointer
+         */
+        template <auto _Function>
+        inline void attach() noexcept
+        {
+            _Publish(&_FunctionBinding<_Function>, nullptr, nullptr, nullptr);
+        }
+
+        /**
+         * @brief The method is intended for binding a lambda function or function to a delegate. 
+         * Function pointers and small trivially copyable lambdas are stored inline, other callables are moved to the heap.
+         * 
+         * @tparam _LabbdaFunction lambda function type transited with template parameter.
+         * @param lfunc 
+         */
+        template <class _LabbdaFunction>
+        inline void attach(_LabbdaFunction &&lfunc)
+        {
+            using _function_t = std::decay_t<_LabbdaFunction>;
+            if constexpr (_IsInline<_function_t>)
+            {
+                const _function_t _function(std::forward<_LabbdaFunction>(lfunc));
+                uintptr_t _storage[s_InlineWords]{};
+                std::memcpy(_storage, &_function, sizeof(_function_t));
+                _Publish(nullptr, &_InlineStub<_function_t>, _storage, nullptr);
+            }
+            else
+            {
+                auto *_binding = new __SharedBinding<_function_t>{{{&_Reclaim, nullptr, this}, &_SharedStub<_function_t>, &_SharedDestroy<_function_t>}, std::forward<_LabbdaFunction>(lfunc)};
+                _Publish(nullptr, nullptr, nullptr, _binding);
+            }
+        }
+
+        /**
+         * @brief For class method. Receiving class pointer and class method reference.
+         * 
+         * @param c Class pointer
+         * @param m Method reference
+         */
+        template <class _Class, class _MethodReturnType, class... MethodArgs>
+        inline void attach(_Class *c, _MethodReturnType (_Class::*m)(MethodArgs...))
+        {
+            attach(__MethodBinding<_Class, _MethodReturnType (_Class::*)(MethodArgs...)>{c, m});
+        }
+
+        /**
+         * @brief For const class method. Receiving const class pointer and class method reference.
+         * 
+         * @param c Const class pointer
+         * @param m Method reference
+         */
+        template <class _Class, class _MethodReturnType, class... MethodArgs>
+        inline void attach(const _Class *c, _MethodReturnType (_Class::*m)(MethodArgs...) const)
+        {
+            attach(__MethodBinding<const _Class, _MethodReturnType (_Class::*)(MethodArgs...) const>{c, m});
+        }
+
+        /**
+         * @brief Detaching function delegate. Waits for readers of the heap record before releasing it.
+         * 
+         */
+        inline void detach() noexcept
+        {
+            _Publish(nullptr, nullptr, nullptr, nullptr);
+        }
+
+        /**
+         * @brief Invokes attached function. Throws std::bad_function_call if nothing was attached, same as std::function.
+         * 
+         * @param args Delegate arguments
+         * @return _ReturnType 
+         */
+        inline _ReturnType operator()(Args... args) const
+        {
+            if (const binding_t *_static = m_Static.load(std::memory_order_acquire))
+            {
+                return _static->stub(_static, std::forward<Args>(args)...);
+            }
+
+            __InlineCopy _inline;
+            if (_LoadInline(_inline))
+            {
+                return _inline.stub(_inline.storage, std::forward<Args>(args)...);
+            }
+
+            __ReadGuard _guard(*this);
+            if (const binding_t *_binding = _LoadBinding(_inline))
+            {
+                return _binding->stub(_binding, std::forward<Args>(args)...);
+            }
+            if (_inline.stub)
+            {
+                return _inline.stub(_inline.storage, std::forward<Args>(args)...);
+            }
+            throw std::bad_function_call();
+        }
+
+        /**
+         * @brief Invokes attached function if it exists. Checking and calling is done on the same binding, 
+         * so concurrent detach cannot make the call throw.
+         * 
+         * @param args Delegate arguments
+         * @return true if function was attached and called
+         */
+        inline bool try_invoke(Args... args) const
+        {
+            static_assert(std::is_same<_ReturnType, void>::value, "try_invoke is available only for delegates with return type 'void'.");
+            if (const binding_t *_static = m_Static.load(std::memory_order_acquire))
+            {
+                _static->stub(_static, std::forward<Args>(args)...);
+                return true;
+            }
+
+            __InlineCopy _inline;
+            if (_LoadInline(_inline))
+            {
+                _inline.stub(_inline.storage, std::forward<Args>(args)...);
+                return true;
+            }
+
+            __ReadGuard _guard(*this);
+            if (const binding_t *_binding = _LoadBinding(_inline))
+            {
+                _binding->stub(_binding, std::forward<Args>(args)...);
+                return true;
+            }
+            if (_inline.stub)
+            {
+                _inline.stub(_inline.storage, std::forward<Args>(args)...);
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * @brief Checks that function was attached
+         * 
+         */
+        explicit operator bool() const noexcept
+        {
+            return m_Static.load(std::memory_order_acquire) != nullptr || m_InlineStub.load(std::memory_order_acquire) != nullptr || 
+                m_Shared.load(std::memory_order_acquire) != nullptr;
+        }
+
+    private:
+        explicit constexpr __DelegateGlobal(const binding_t *_static) noexcept : m_Static(_static) {}
+
+        template <class _Class, class _Method>
+        struct __MethodBinding
+        {
+            _Class *c;
+            _Method m;
+
+            inline _ReturnType operator()(Args... args) const
+            {
+                return (c->*m)(std::forward<Args>(args)...);
+            }
+        };
+
+        /**
+         * @brief Registers reader in the counter of the current phase for the time of the call. Records retired by the handler 
+         * are released after the outermost guard of the thread exits, see __DelegateGlobalReaders.
+         * 
+         */
+        struct __ReadGuard
+        {
+            explicit __ReadGuard(const __DelegateGlobal &_delegate) noexcept
+                : m_Counter(_delegate.m_Readers[_delegate.m_Phase.load() & 1u])
+            {
+                m_Counter.fetch_add(1);
+                __DelegateGlobalReaders::enter();
+            }
+
+            ~__ReadGuard()
+            {
+                m_Counter.fetch_sub(1, std::memory_order_release);
+                __DelegateGlobalReaders::leave();
+            }
+
+            std::atomic<uint32_t> &m_Counter;
+        };
+
+        template <auto _Function>
+        static _ReturnType _FunctionStub(const binding_t *, Args... args)
+        {
+            return _Function(std::forward<Args>(args)...);
+        }
+
+        template <class _Function>
+        static _ReturnType _InlineStub(const void *_storage, Args... args)
+        {
+            return (*std::launder(reinterpret_cast<const _Function *>(_storage)))(std::forward<Args>(args)...);
+        }
+
+        template <class _Function>
+        static _ReturnType _SharedStub(const binding_t *_binding, Args... args)
+        {
+            return static_cast<const __SharedBinding<_Function> *>(_binding)->function(std::forward<Args>(args)...);
+        }
+
+        template <class _Function>
+        static void _SharedDestroy(const binding_t *_binding)
+        {
+            delete static_cast<const __SharedBinding<_Function> *>(_binding);
+        }
+
+        template <auto _Function>
+        static constexpr binding_t _FunctionBinding{{nullptr, nullptr, nullptr}, &_FunctionStub<_Function>, nullptr};
+
+        /**
+         * @brief Copies the inline binding out. Retries while a writer is swapping it, so the copy is never torn.
+         * 
+         * @param _inline Copy of the binding
+         * @return true if the inline binding is attached
+         */
+        inline bool _LoadInline(__InlineCopy &_inline) const noexcept
+        {
+            for (;;)
+            {
+                const uint32_t _sequence = m_Sequence.load(std::memory_order_acquire);
+                if (_sequence & 1u)
+                {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                _inline.stub = m_InlineStub.load(std::memory_order_relaxed);
+                if (!_inline.stub)
+                {
+                    return false;
+                }
+                for (std::size_t _word = 0; _word < s_InlineWords; ++_word)
+                {
+                    _inline.storage[_word] = m_Inline[_word].load(std::memory_order_relaxed);
+                }
+
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (m_Sequence.load(std::memory_order_relaxed) == _sequence)
+                {
+                    return true;
+                }
+            }
+        }
+
+        /**
+         * @brief Loads the heap record under the read guard. The binding could be swapped to another kind 
+         * after the fast paths have checked it, the new one is published before the record is removed, so it is loaded again.
+         * 
+         * @param _inline Receives the inline binding if it was attached meanwhile
+         * @return Heap or static record, nullptr otherwise
+         */
+        inline const binding_t *_LoadBinding(__InlineCopy &_inline) const noexcept
+        {
+            _inline.stub = nullptr;
+            if (const binding_t *_binding = m_Shared.load())
+            {
+                return _binding;
+            }
+            if (const binding_t *_static = m_Static.load())
+            {
+                return _static;
+            }
+            _LoadInline(_inline);
+            return nullptr;
+        }
+
+        /**
+         * @brief Publishes the new binding and releases the previous heap record after the grace period.
+         * The new binding is published before the old one is removed, so readers always see one of them. 
+         * The grace period runs outside of the writer lock. When the writer is a handler of a global delegate, 
+         * the record is handed over to the outermost read guard of the thread instead of waiting.
+         * 
+         * @param _static Static record or nullptr
+         * @param _stub Stub of the inline binding or nullptr
+         * @param _storage Inline binding
+         * @param _shared Heap record or nullptr
+         */
+        inline void _Publish(const binding_t *_static, inline_stub_t _stub, const uintptr_t *_storage, const binding_t *_shared) noexcept
+        {
+            while (m_Writing.exchange(true, std::memory_order_acquire))
+            {
+                std::this_thread::yield();
+            }
+
+            const binding_t *_retired{nullptr};
+            if (_static)
+            {
+                m_Static.store(_static);
+            }
+            else if (_shared)
+            {
+                _retired = m_Shared.exchange(_shared);
+            }
+            _StoreInline(_stub, _storage);
+            if (!_static)
+            {
+                m_Static.store(nullptr);
+            }
+            if (!_shared)
+            {
+                _retired = m_Shared.exchange(nullptr);
+            }
+
+            m_Writing.store(false, std::memory_order_release);
+
+            if (_retired && !__DelegateGlobalReaders::defer(_retired))
+            {
+                _Reclaim(_retired);
+            }
+        }
+
+        /**
+         * @brief Swaps the inline binding under the sequence counter, called by the writer only
+         * 
+         * @param _stub Stub of the inline binding or nullptr
+         * @param _storage Inline binding
+         */
+        inline void _StoreInline(inline_stub_t _stub, const uintptr_t *_storage) noexcept
+        {
+            if (!_stub && !m_InlineStub.load(std::memory_order_relaxed))
+            {
+                return;
+            }
+
+            const uint32_t _sequence = m_Sequence.load(std::memory_order_relaxed);
+            m_Sequence.store(_sequence + 1u, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            m_InlineStub.store(_stub, std::memory_order_relaxed);
+            for (std::size_t _word = 0; _stub && _word < s_InlineWords; ++_word)
+            {
+                m_Inline[_word].store(_storage[_word], std::memory_order_relaxed);
+            }
+            m_Sequence.store(_sequence + 2u, std::memory_order_release);
+        }
+
+        /**
+         * @brief Waits for the grace period of the owner and releases the retired heap record
+         * 
+         * @param _retired Retired record
+         */
+        static void _Reclaim(const __DelegateGlobalRetired *_retired) noexcept
+        {
+            const binding_t *_binding = static_cast<const binding_t *>(_retired);
+            static_cast<const __DelegateGlobal *>(_binding->owner)->_Synchronize();
+            _binding->destroy(_binding);
+        }
+
+        /**
+         * @brief Waits until every reader that could see the retired record has left. Both counters are drained 
+         * after flipping the phase, new readers register in the other counter and cannot delay the writer.
+         * Grace periods of concurrent writers are serialized, otherwise their flips could interleave 
+         * so that one of them drains the same counter twice and never the one the reader is registered in.
+         * 
+         */
+        inline void _Synchronize() const noexcept
+        {
+            while (m_Synchronizing.exchange(true, std::memory_order_acquire))
+            {
+                std::this_thread::yield();
+            }
+
+            for (int _pass = 0; _pass < 2; ++_pass)
+            {
+                const uint32_t _phase = m_Phase.fetch_xor(1u);
+                while (m_Readers[_phase & 1u].load() != 0)
+                {
+                    std::this_thread::yield();
+                }
+            }
+
+            m_Synchronizing.store(false, std::memory_order_release);
+        }
+
+        std::atomic<const binding_t *> m_Static{nullptr};
+        std::atomic<inline_stub_t> m_InlineStub{nullptr};
+        std::atomic<uintptr_t> m_Inline[s_InlineWords]{};
+        std::atomic<uint32_t> m_Sequence{0};
+        std::atomic<const binding_t *> m_Shared{nullptr};
+        mutable std::atomic<uint32_t> m_Phase{0};
+        mutable std::atomic<uint32_t> m_Readers[2]{};
+        std::atomic<bool> m_Writing{false};
+        mutable std::atomic<bool> m_Synchronizing{false};
+    };
+
+    static_assert(std::is_trivially_destructible<__DelegateGlobal<void()>>::value, "Global delegate should not register destructor at exit.");
+
+    template <class _Signature>
+    using TDelegateGlobal = __DelegateGlobal<_Signature>;
+}
@@ -377,30 +377,148 @@ Exhibit B - "Incompatible With Secondary Licenses" Notice
  */
 
 #pragma once
+#include <cstdint>
 #include <tuple>
 #include <type_traits>
 
+/**
+ * @brief Expands to constinit when the compiler supports it. Without it the globals of the library still get
+ * constant initialization, because their initializers are constant expressions.
+ */
+#if defined(__cpp_constinit)
+#define EASY_DELEGATE_CONSTINIT constinit
+#else
+#define EASY_DELEGATE_CONSTINIT
+#endif
+
 namespace EasyDelegate
 {
     /**
-     * @brief The method translates the value of the numerator to the key for the template specialization.
+     * @brief The method translates the value of the enumerator to the key for the template specialization.
+     * The key keeps the enumerator type, so equal values of different enumerators never collide.
      * 
      * @tparam _Enumerator Enumeration class
      * @param eBase Enumerator value
-     * @return constexpr uint32_t 
+     * @return constexpr _Enumerator 
      */
     template<class _Enumerator, _Enumerator eBase>
-    [[nodiscard]] constexpr inline uint32_t TakeStoreKey() noexcept
+    [[nodiscard]] constexpr inline _Enumerator TakeStoreKey() noexcept
+    {
+        static_assert(std::is_enum<_Enumerator>::value, "Store key should be an enumerator value.");
+        return eBase;
+    }
+
+    /**
+     * @brief Translates the enumerator value to the index used by dispatch tables and instrumentation. The index is the 
+     * underlying value of the enumerator, not a dense renumbering: tables keep the gaps between sparse values and negative 
+     * values wrap to large indices. Containers with runtime keys keep sparse keys out of their tables, TDelegateAnyCT scans 
+     * only __DelegateKeyRange of the enumerator, so specialize the range for enumerators with values far from zero.
+     * 
+     * @tparam _Enumerator Enumeration class
+     * @param eBase Enumerator value
+     * @return constexpr uint32_t 
+     */
+    template<class _Enumerator>
+    [[nodiscard]] constexpr inline uint32_t TakeKeyIndex(_Enumerator eBase) noexcept
     {
-        return static_cast<uint32_t>(eBase);
+        static_assert(std::is_enum<_Enumerator>::value, "Key index can be taken only from an enumerator value.");
+        return static_cast<uint32_t>(static_cast<std::underlying_type_t<_Enumerator>>(eBase));
     }
 
-    template<uint32_t>
+    /**
+     * @brief Types declared for the key. signature is the delegate signature of the key, type is __Delegate<signature>
+     * that TDelegateAny stores for runtime keys. It is not the type of the global object of compile-time keys,
+     * see __DelegateObjectStore.
+     *
+     * @tparam eKey Store key, see TakeStoreKey
+     */
+    template<auto>
     struct __DelegateTypeStore;
 
-    template<uint32_t>
+    /**
+     * @brief Global object of the key declared with DeclareDelegateFuncCompileTime, value is a constinit
+     * __DelegateGlobal<signature> that needs no dynamic initialization.
+     *
+     * @tparam eKey Store key, see TakeStoreKey
+     */
+    template<auto>
     struct __DelegateObjectStore;
 
+    /**
+     * @brief Range of enumerator indices scanned for keys declared with DeclareDelegateFuncCompileTime.
+     * Specialize it before the declarations for an enumerator that has values outside of the default range, 
+     * keys outside of the range can't be executed by a runtime key.
+     * 
+     * @tparam _Enumerator Enumerator class
+     */
+    template<class _Enumerator>
+    struct __DelegateKeyRange
+    {
+        static constexpr uint32_t first = 0;
+        static constexpr uint32_t last = 63;
+    };
+
+    /**
+     * @brief Opt-in check of the declared keys. Specialize it as std::true_type before the declarations, 
+     * then declaring a key outside of __DelegateKeyRange of the enumerator is a compile-time error.
+     * 
+     * @tparam _Enumerator Enumerator class
+     */
+    template<class _Enumerator>
+    struct __DelegateStrictKeys : std::false_type {};
+
+    /**
+     * @brief Checks that the key lies inside __DelegateKeyRange of its enumerator
+     * 
+     * @tparam _Enumerator Enumerator class
+     * @param eBase Enumerator value
+     * @return true if the key is inside the range
+     */
+    template<class _Enumerator>
+    [[nodiscard]] constexpr inline bool IsInKeyRange(_Enumerator eBase) noexcept
+    {
+        const uint32_t index = TakeKeyIndex(eBase);
+        return index >= __DelegateKeyRange<_Enumerator>::first && index <= __DelegateKeyRange<_Enumerator>::last;
+    }
+
+    /**
+     * @brief Checks the declared key. Every declaration with DeclareDelegateFuncCompileTime asserts it, 
+     * keys of enumerators with __DelegateStrictKeys should be reachable by the runtime lookup.
+     * 
+     * @tparam _Enumerator Enumerator class
+     * @param eBase Enumerator value
+     * @return true if the key can be declared
+     */
+    template<class _Enumerator>
+    [[nodiscard]] constexpr inline bool IsDeclarableKey(_Enumerator eBase) noexcept
+    {
+        return !__DelegateStrictKeys<_Enumerator>::value || IsInKeyRange(eBase);
+    }
+
+    /**
+     * @brief Checks that the global delegate was declared for the key. DeclareDelegateFuncCompileTime specializes it explicitly, 
+     * so a declaration placed after the runtime key table of the enumerator was built fails to compile 
+     * (specialization after instantiation) instead of being left out of the table.
+     * 
+     * @tparam eKey Store key
+     */
+    template<auto eKey>
+    struct __IsDelegateDeclared : std::false_type {};
+
+    class __DelegateThreadPool;
+
+    /**
+     * @brief Names the library thread pool through a dependent type, so invoke_async of the containers is resolved 
+     * on instantiation and their headers don't include EasyDelegateThreadPoolImpl.hpp. EasyDelegate.hpp includes it.
+     * 
+     * @tparam Args Arguments of the call
+     */
+    template<class... Args>
+    struct __DelegateAsyncPool
+    {
+        using type = __DelegateThreadPool;
+    };
+
     /**
      * @brief A helper template for dividing a signature into a return type and a list of argument types
      * 
@@ -420,6 +538,8 @@ namespace EasyDelegate
     {
         using return_type = _ReturnType;
         using argument_type = std::tuple<Args...>;
+        using value_type = std::tuple<std::decay_t<Args>...>;
+        using pointer_type = _ReturnType (*)(Args...);
     };
 
     /**
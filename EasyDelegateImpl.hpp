@@ -379,6 +379,9 @@ Exhibit B - "Incompatible With Secondary Licenses" Notice
 #pragma once
 #include <functional>
 #include "EasyDelegateGlobalTemplates.hpp"
+#include "EasyDelegateInstrumentationImpl.hpp"
+#include "EasyDelegateComposeImpl.hpp"
+#include "EasyDelegateBindImpl.hpp"
 
 namespace EasyDelegate
 {
@@ -388,13 +391,20 @@ namespace EasyDelegate
      * method or a static function for further invocation. 
      * 
      * @tparam _Signature signature of the delegate function
+     * @tparam _Policy Instrumentation policy, calls are recorded under DelegateKeyIndex
      */
-    template <class _Signature>
+    template <class _Signature, class _Policy = __NoInstrumentation>
     class __Delegate : public std::function<_Signature>
     {
         using base_t = std::function<_Signature>;
 
     public:
+        using return_type = typename __SignatureDesc<_Signature>::return_type;
+        using argument_type = typename __SignatureDesc<_Signature>::argument_type;
+        using value_type = typename __SignatureDesc<_Signature>::value_type;
+        using result_pointer = std::conditional_t<std::is_void<return_type>::value, std::nullptr_t, return_type *>;
+        using pointer_type = typename __SignatureDesc<_Signature>::pointer_type;
+
         __Delegate() = default;
 
         /**
@@ -403,7 +413,7 @@ namespace EasyDelegate
          * @tparam _LabbdaFunction 
          * @param lfunc 
          */
-        template <class _LabbdaFunction>
+        template <class _LabbdaFunction, class = std::enable_if_t<!std::is_base_of<base_t, std::decay_t<_LabbdaFunction>>::value>>
         __Delegate(_LabbdaFunction &&lfunc)
         {
             attach(std::forward<_LabbdaFunction>(lfunc));
@@ -427,7 +437,7 @@ namespace EasyDelegate
          * 
          * @param rDelegate 
          */
-        __Delegate(const __Delegate<_Signature> &rDelegate) = default;
+        __Delegate(const __Delegate &rDelegate) = default;
 
         /**
          * @brief Default copy assignment operator
@@ -435,14 +445,14 @@ namespace EasyDelegate
          * @param lDelegate 
          * @return __Delegate<_Signature>& 
          */
-        __Delegate<_Signature> &operator=(const __Delegate<_Signature> &lDelegate) = default;
+        __Delegate &operator=(const __Delegate &lDelegate) = default;
 
         /**
          * @brief Default move constructor
          * 
          * @param rDelegate 
          */
-        __Delegate(__Delegate<_Signature> &&rDelegate) = default;
+        __Delegate(__Delegate &&rDelegate) = default;
 
         /**
          * @brief Default move assignment constructor
@@ -450,7 +460,7 @@ namespace EasyDelegate
          * @param rDelegate 
          * @return __Delegate<_Signature>& 
          */
-        __Delegate<_Signature> &operator=(__Delegate<_Signature> &&rDelegate) = default;
+        __Delegate &operator=(__Delegate &&rDelegate) = default;
 
         /**
          * @brief The method is intended for binding a lambda function or function to a delegate.
@@ -461,7 +471,7 @@ namespace EasyDelegate
         template <class _LabbdaFunction>
         inline void attach(_LabbdaFunction &&lfunc) noexcept
         {
-            base_t::_Reset(std::forward<_LabbdaFunction>(lfunc));
+            base_t::operator=(std::forward<_LabbdaFunction>(lfunc));
         }
 
         /**
@@ -474,7 +484,21 @@ namespace EasyDelegate
         template <class _Class, class _ReturnType, class... Args>
         inline void attach(_Class *c, _ReturnType (_Class::*m)(Args...)) noexcept
         {
-            base_t::_Reset(std::move(make_delegate(c, m)));
+            attach(make_delegate(c, m));
+        }
+
+        /**
+         * @brief Binds the function or class method known at compile time together with the first arguments. 
+         * Values are stored inline, so an object pointer bound to a method does not allocate.
+         * 
+         * @tparam _Function Pointer to the function or class method
+         * @tparam Bound Bound value types
+         * @param bound Values stored by copy, object pointer goes first for methods
+         */
+        template <auto _Function, class... Bound>
+        inline void attach(Bound &&...bound) noexcept
+        {
+            attach(bind_front<_Function>(std::forward<Bound>(bound)...));
         }
 
         /**
@@ -483,7 +507,7 @@ namespace EasyDelegate
          */
         inline void detach() noexcept
         {
-            //base_t::_Set(nullptr);
+            base_t::operator=(nullptr);
         }
 
         /**
@@ -496,10 +520,145 @@ namespace EasyDelegate
         template <class... Args>
         inline auto operator()(Args &&...args)
         {
+            typename _Policy::scope _scope(DelegateKeyIndex);
             return base_t::operator()(std::forward<Args>(args)...);
         }
 
-    private:
+        /**
+         * @brief Guarded call for monomorphic call sites. When the expected function is attached it is called directly and can be inlined, 
+         * otherwise the call goes through the delegate. The type of the stored object is not remembered, so the check costs up to two 
+         * target<>() type checks, one for a function pointer and one for stage<_Expected>. TTypedDelegate compares the stored function instead.
+         * 
+         * @tparam _Expected Function the call site usually sees
+         * @tparam Args Templated std::tuple arguments 
+         * @param args Delegate arguments
+         * @return auto 
+         */
+        template <auto _Expected, class... Args>
+        inline auto invoke_expect(Args &&...args)
+        {
+            static_assert(std::is_convertible<decltype(_Expected), pointer_type>::value, "Expected function should match the delegate signature.");
+            if (_Holds<_Expected>())
+            {
+                typename _Policy::scope _scope(DelegateKeyIndex);
+                return _Expected(std::forward<Args>(args)...);
+            }
+            return (*this)(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Invokes the delegate on the library thread pool. The delegate should outlive the returned future.
+         * 
+         * @tparam Args Templated std::tuple arguments 
+         * @param args Delegate arguments, stored by value until the call
+         * @return Future of the call result, waits for the call on destruction
+         */
+        template <class... Args>
+        [[nodiscard]] inline auto invoke_async(Args &&...args)
+        {
+            return __DelegateAsyncPool<Args...>::type::instance().submit(std::ref(*this), std::forward<Args>(args)...);
+        }
+
+    protected:
+        template <class... Args>
+        struct __Columns;
+
+        template <class... Args>
+        struct __Columns<std::tuple<Args...>>
+        {
+            using type = std::tuple<const Args *...>;
+        };
+
+        using columns_t = typename __Columns<value_type>::type;
+
+        //Stored values can be passed to the signature: copyable values and const references
+        template <class... Args>
+        static constexpr bool _Batchable(std::tuple<Args...> *) noexcept
+        {
+            return ((std::is_reference<Args>::value ? std::is_const<std::remove_reference_t<Args>>::value : std::is_copy_constructible<Args>::value) && ...);
+        }
+
+        //Passes the stored value the same way std::function passes the argument of the signature
+        template <class _Argument, class _Value>
+        static inline decltype(auto) _Pass(const _Value &value)
+        {
+            static_assert(!std::is_reference<_Argument>::value || std::is_const<std::remove_reference_t<_Argument>>::value, "Batch calls do not support non-const reference arguments.");
+            if constexpr (std::is_reference<_Argument>::value)
+            {
+                return (value);
+            }
+            else
+            {
+                return _Argument(value);
+            }
+        }
+
+        template <class _Function, std::size_t... Indices>
+        static inline decltype(auto) _CallRow(_Function &function, const value_type &args, std::index_sequence<Indices...>)
+        {
+            return function(_Pass<std::tuple_element_t<Indices, argument_type>>(std::get<Indices>(args))...);
+        }
+
+        template <class _Function, std::size_t... Indices>
+        static inline decltype(auto) _CallColumn(_Function &function, const columns_t &columns, [[maybe_unused]] std::size_t index, std::index_sequence<Indices...>)
+        {
+            return function(_Pass<std::tuple_element_t<Indices, argument_type>>(std::get<Indices>(columns)[index])...);
+        }
+
+        template <class _Function>
+        static inline void _Loop(_Function &function, const value_type *rows, const columns_t *columns, result_pointer results, std::size_t count)
+        {
+            constexpr auto sequence = std::make_index_sequence<std::tuple_size<value_type>::value>{};
+            if constexpr (std::is_void<return_type>::value)
+            {
+                for (std::size_t index = 0; index < count; ++index)
+                {
+                    rows ? _CallRow(function, rows[index], sequence) : _CallColumn(function, *columns, index, sequence);
+                }
+            }
+            else if (rows && results)
+            {
+                for (std::size_t index = 0; index < count; ++index)
+                {
+                    results[index] = _CallRow(function, rows[index], sequence);
+                }
+            }
+            else if (results)
+            {
+                for (std::size_t index = 0; index < count; ++index)
+                {
+                    results[index] = _CallColumn(function, *columns, index, sequence);
+                }
+            }
+            else
+            {
+                for (std::size_t index = 0; index < count; ++index)
+                {
+                    rows ? (void)_CallRow(function, rows[index], sequence) : (void)_CallColumn(function, *columns, index, sequence);
+                }
+            }
+        }
+
+        //Checks the stored object against the expected function without knowing the type of the attached callable. 
+        //When the stored type is visible to the optimizer GCC follows target() into the manager of another type 
+        //and reports -Wmaybe-uninitialized for the pointer the manager never writes on that path.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+        template <auto _Expected>
+        inline bool _Holds() const noexcept
+        {
+            if (const pointer_type *_target = base_t::template target<pointer_type>())
+            {
+                return *_target == static_cast<pointer_type>(_Expected);
+            }
+            return base_t::template target<__DelegateStage<_Expected>>() != nullptr;
+        }
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
         /**
          * @brief 
          * 
@@ -508,10 +667,10 @@ namespace EasyDelegate
          * @tparam ReturnType (set automatically in c++17) class type
          * @tparam Args (set automatically in c++17) another arguments
          * @param m reference to function
-         * @return std::function<ReturnType(Args...)> 
+         * @return Lambda object calling the function
          */
         template <class _ReturnType, class... Args>
-        inline std::function<_ReturnType(Args...)> make_delegate(_ReturnType (*m)(Args...)) noexcept
+        inline auto make_delegate(_ReturnType (*m)(Args...)) noexcept
         {
             return [=](Args &&...args)
             { return (*m)(std::forward<Args>(args)...); };
@@ -527,10 +686,10 @@ namespace EasyDelegate
          * @tparam Args (set automatically in c++17)
          * @param c pointer to class
          * @param m reference to class method
-         * @return std::function<ReturnType(Args...)> 
+         * @return Lambda object calling the function
          */
         template <class _Class, class _ReturnType, class... Args>
-        inline std::function<_ReturnType(Args...)> make_delegate(_Class *c, _ReturnType (_Class::*m)(Args...)) noexcept
+        inline auto make_delegate(_Class *c, _ReturnType (_Class::*m)(Args...)) noexcept
         {
             return [=](Args &&...args)
             { return (c->*m)(std::forward<Args>(args)...); };
@@ -546,18 +705,275 @@ namespace EasyDelegate
          * @tparam Args (set automatically in c++17)
          * @param c const pointer to class
          * @param m reference to class method
-         * @return std::function<ReturnType(Args...)> 
+         * @return Lambda object calling the function
          */
         template <class _Class, class _ReturnType, class... Args>
-        inline std::function<_ReturnType(Args...)> make_delegate(const _Class *c, _ReturnType (_Class::*m)(Args...) const) noexcept
+        inline auto make_delegate(const _Class *c, _ReturnType (_Class::*m)(Args...) const) noexcept
         {
             return [=](Args &&...args)
             { return (c->*m)(std::forward<Args>(args)...); };
         }
     };
 
-    template <class _Signature>
-    using TDelegate = __Delegate<_Signature>;
+    static_assert(sizeof(__Delegate<void()>) == sizeof(std::function<void()>), "Delegate should not add storage to std::function.");
+
+    /**
+     * @brief Delegate that remembers the type of the attached callable. Batches reach the attached function directly, 
+     * so lambdas and methods are inlined into the loop, and statically bound functions are exposed by raw_target. 
+     * Costs two pointers on top of TDelegate, use it for delegates called in batches or from monomorphic call sites. 
+     * The delegate base is private, every rebinding goes through attach, so the remembered type always matches the stored object.
+     * 
+     * @tparam _Signature signature of the delegate function
+     * @tparam _Policy Instrumentation policy, calls are recorded under DelegateKeyIndex
+     */
+    template <class _Signature, class _Policy = __NoInstrumentation>
+    class __TypedDelegate : private __Delegate<_Signature, _Policy>
+    {
+        using delegate_t = __Delegate<_Signature, _Policy>;
+        using base_t = std::function<_Signature>;
+        using typename delegate_t::columns_t;
+
+    public:
+        using typename delegate_t::argument_type;
+        using typename delegate_t::pointer_type;
+        using typename delegate_t::result_pointer;
+        using typename delegate_t::return_type;
+        using typename delegate_t::value_type;
+
+        using delegate_t::operator();
+        using delegate_t::invoke_async;
+        using base_t::operator bool;
+
+        __TypedDelegate() = default;
+
+        /**
+         * @brief Construct a new delegate object with lambda function or static function.
+         * 
+         * @tparam _LabbdaFunction 
+         * @param lfunc 
+         */
+        template <class _LabbdaFunction, class = std::enable_if_t<!std::is_base_of<base_t, std::decay_t<_LabbdaFunction>>::value>>
+        __TypedDelegate(_LabbdaFunction &&lfunc)
+        {
+            attach(std::forward<_LabbdaFunction>(lfunc));
+        }
+
+        /**
+         * @brief Construct a new delegate object for class or const class method. Receiving class pointer and class method reference.
+         * 
+         * @param c Class pointer
+         * @param m Method reference
+         */
+        template <class _Class, class _ReturnType, class... Args>
+        __TypedDelegate(_Class *c, _ReturnType (_Class::*m)(Args...)) noexcept
+        {
+            attach(c, m);
+        }
+
+        /**
+         * @brief Assigns the lambda function or function, the type is remembered the same way as with attach
+         * 
+         * @tparam _LabbdaFunction 
+         * @param lfunc 
+         * @return __TypedDelegate& 
+         */
+        template <class _LabbdaFunction, class = std::enable_if_t<!std::is_base_of<base_t, std::decay_t<_LabbdaFunction>>::value>>
+        __TypedDelegate &operator=(_LabbdaFunction &&lfunc) noexcept
+        {
+            attach(std::forward<_LabbdaFunction>(lfunc));
+            return *this;
+        }
+
+        /**
+         * @brief Binds the lambda function or function and remembers its type
+         * 
+         * @tparam _LabbdaFunction lambda function type transited with template parameter.
+         * @param lfunc 
+         */
+        template <class _LabbdaFunction>
+        inline void attach(_LabbdaFunction &&lfunc) noexcept
+        {
+            using function_t = std::decay_t<_LabbdaFunction>;
+            delegate_t::attach(std::forward<_LabbdaFunction>(lfunc));
+            //Type of the stored object is known only here, batches are bound to it
+            if constexpr (std::is_base_of<base_t, function_t>::value || std::is_same<function_t, std::nullptr_t>::value || !delegate_t::_Batchable(static_cast<argument_type *>(nullptr)))
+            {
+                m_Batch = nullptr;
+            }
+            else
+            {
+                m_Batch = &_Batch<function_t>;
+            }
+            m_Raw = _RawTarget<function_t>();
+        }
+
+        /**
+         * @brief For class or const class method. Receiving class pointer and class method reference.
+         * 
+         * @param c Class pointer
+         * @param m Method reference
+         */
+        template <class _Class, class _ReturnType, class... Args>
+        inline void attach(_Class *c, _ReturnType (_Class::*m)(Args...)) noexcept
+        {
+            attach(delegate_t::make_delegate(c, m));
+        }
+
+        /**
+         * @brief Binds the function or class method known at compile time together with the first arguments
+         * 
+         * @tparam _Function Pointer to the function or class method
+         * @tparam Bound Bound value types
+         * @param bound Values stored by copy, object pointer goes first for methods
+         */
+        template <auto _Function, class... Bound>
+        inline void attach(Bound &&...bound) noexcept
+        {
+            attach(bind_front<_Function>(std::forward<Bound>(bound)...));
+        }
+
+        /**
+         * @brief Detaching function delegate
+         * 
+         */
+        inline void detach() noexcept
+        {
+            delegate_t::detach();
+            m_Batch = nullptr;
+            m_Raw = nullptr;
+        }
+
+        /**
+         * @brief Returns the attached function if the delegate was bound statically (function pointer with the exact signature or stage<&function>)
+         * 
+         * @return pointer_type Raw function or nullptr for lambdas, methods and other objects
+         */
+        [[nodiscard]] inline pointer_type raw_target() const noexcept
+        {
+            return m_Raw;
+        }
+
+        /**
+         * @brief Guarded call for monomorphic call sites. The attached function is remembered on attach, so the check 
+         * costs one pointer comparison, unlike TDelegate::invoke_expect that checks the type of the stored object.
+         * 
+         * @tparam _Expected Function the call site usually sees
+         * @tparam Args Templated std::tuple arguments 
+         * @param args Delegate arguments
+         * @return auto 
+         */
+        template <auto _Expected, class... Args>
+        inline auto invoke_expect(Args &&...args)
+        {
+            static_assert(std::is_convertible<decltype(_Expected), pointer_type>::value, "Expected function should match the delegate signature.");
+            if (m_Raw == static_cast<pointer_type>(_Expected))
+            {
+                typename _Policy::scope _scope(DelegateKeyIndex);
+                return _Expected(std::forward<Args>(args)...);
+            }
+            return (*this)(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Calls the delegate for every argument tuple of the array. The attached function is reached once per batch 
+         * and called from the tight loop, so the compiler can inline and vectorize it.
+         * 
+         * @param args Array of argument tuples
+         * @param count Count of calls
+         * @param results Array of count results, can be nullptr to drop the results
+         */
+        inline void invoke_batch(const value_type *args, std::size_t count, result_pointer results = nullptr)
+        {
+            static_assert(delegate_t::_Batchable(static_cast<argument_type *>(nullptr)), "Batch calls require copyable arguments passed by value or by const reference.");
+            typename _Policy::scope _scope(DelegateKeyIndex);
+            _BatchOrFallback(args, nullptr, results, count);
+        }
+
+        /**
+         * @brief Calls the delegate for every index of the argument columns (structure of arrays). The attached function is reached 
+         * once per batch and called from the tight loop, so the compiler can inline and vectorize it.
+         * 
+         * @tparam Columns Decayed argument types of the signature
+         * @param count Count of calls
+         * @param results Array of count results, can be nullptr to drop the results
+         * @param columns One array of count values per argument
+         */
+        template <class... Columns>
+        inline void invoke_batch_soa(std::size_t count, result_pointer results, const Columns *...columns)
+        {
+            static_assert(std::is_same<std::tuple<Columns...>, value_type>::value, "Columns should match the decayed arguments of the delegate.");
+            static_assert(delegate_t::_Batchable(static_cast<argument_type *>(nullptr)), "Batch calls require copyable arguments passed by value or by const reference.");
+            typename _Policy::scope _scope(DelegateKeyIndex);
+            const columns_t _columns(columns...);
+            _BatchOrFallback(nullptr, &_columns, results, count);
+        }
+
+    private:
+        using batch_t = bool (*)(base_t &, const value_type *, const columns_t *, result_pointer, std::size_t);
+
+        template <class _Function>
+        static bool _Batch(base_t &self, const value_type *rows, const columns_t *columns, result_pointer results, std::size_t count)
+        {
+            _Function *function = self.template target<_Function>();
+            if (!function)
+            {
+                return false;
+            }
+            delegate_t::_Loop(*function, rows, columns, results, count);
+            return true;
+        }
+
+        template <class _Function>
+        inline pointer_type _RawTarget() const noexcept
+        {
+            if constexpr (std::is_same<_Function, pointer_type>::value)
+            {
+                //A null function pointer leaves the delegate empty
+                auto _target = base_t::template target<_Function>();
+                return _target ? *_target : nullptr;
+            }
+            else
+            {
+                return _StageTarget(static_cast<_Function *>(nullptr));
+            }
+        }
+
+        template <auto _Function>
+        static constexpr pointer_type _StageTarget(__DelegateStage<_Function> *) noexcept
+        {
+            if constexpr (std::is_convertible<decltype(_Function), pointer_type>::value)
+            {
+                return _Function;
+            }
+            else
+            {
+                return nullptr;
+            }
+        }
+
+        static constexpr pointer_type _StageTarget(const void *) noexcept
+        {
+            return nullptr;
+        }
+
+        inline void _BatchOrFallback(const value_type *rows, const columns_t *columns, result_pointer results, std::size_t count)
+        {
+            if (!m_Batch || !m_Batch(*this, rows, columns, results, count))
+            {
+                base_t &function = *this;
+                delegate_t::_Loop(function, rows, columns, results, count);
+            }
+        }
+
+        batch_t m_Batch{nullptr};
+        pointer_type m_Raw{nullptr};
+    };
+
+    template <class _Signature, class _Policy = __NoInstrumentation>
+    using TDelegate = __Delegate<_Signature, _Policy>;
+
+    template <class _Signature, class _Policy = __NoInstrumentation>
+    using TTypedDelegate = __TypedDelegate<_Signature, _Policy>;
 }
 
 /**
@@ -631,6 +1047,108 @@ int main()
 
     return 0;
 }
+ *   @endcode
+ * 
+ */
+/**
+ * @example BatchInvokeExample
+ * 
+ * @code
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "EasyDelegate.hpp"
+
+using namespace EasyDelegate;
+
+float scale(float value, float factor)
+{
+    return value * factor;
+}
+
+class FCounter
+{
+public:
+    void count(const std::string& word)
+    {
+        letters += word.size();
+    }
+
+    std::size_t letters{0};
+};
+
+int main()
+{
+    TTypedDelegate<float(float, float)> _scale(&scale);
+
+    //Structure of arrays, one array per argument
+    std::vector<float> _values(10000, 2.f), _factors(10000, 0.5f), _results(10000);
+    _scale.invoke_batch_soa(_values.size(), _results.data(), _values.data(), _factors.data());
+
+    //Array of argument tuples
+    std::vector<std::tuple<float, float>> _rows{{1.f, 2.f}, {3.f, 4.f}, {5.f, 6.f}};
+    std::vector<float> _rowResults(_rows.size());
+    _scale.invoke_batch(_rows.data(), _rows.size(), _rowResults.data());
+
+    //Lambdas are inlined into the loop as well
+    TTypedDelegate<int(int)> _square([](int x) { return x * x; });
+    std::vector<std::tuple<int>> _numbers{{1}, {2}, {3}, {4}};
+    std::vector<int> _squares(_numbers.size());
+    _square.invoke_batch(_numbers.data(), _numbers.size(), _squares.data());
+
+    //Delegates without result
+    FCounter _counter;
+    TTypedDelegate<void(const std::string&)> _count(&_counter, &FCounter::count);
+    std::vector<std::tuple<std::string>> _words{{"batch"}, {"of"}, {"words"}};
+    _count.invoke_batch(_words.data(), _words.size());
+
+    std::cout << "scaled: " << _results.front() << ", rows: " << _rowResults.back() << ", squares: " << _squares.back() << ", letters: " << _counter.letters << std::endl;
+    return 0;
+}
+
+ *   @endcode
+ * 
+ */
+/**
+ * @example InlineCacheExample
+ * 
+ * @code
+#include <iostream>
+#include "EasyDelegate.hpp"
+
+using namespace EasyDelegate;
+
+int add(int x, int y)
+{
+    return x + y;
+}
+
+int multiply(int x, int y)
+{
+    return x * y;
+}
+
+int main()
+{
+    TTypedDelegate<int(int, int)> _hot(&add), _cold(&multiply);
+
+    //Static bindings expose the attached function, lambdas and methods return nullptr
+    std::cout << "raw target: " << (_hot.raw_target() == &add) << std::endl;
+    std::cout << "lambda raw target: " << (TTypedDelegate<int(int, int)>([](int x, int y) { return x - y; }).raw_target() == nullptr) << std::endl;
+
+    //Hit: add is called directly and inlined into the call site
+    std::cout << _hot.invoke_expect<&add>(2, 3) << std::endl;
+
+    //Miss: falls back to the regular delegate call
+    std::cout << _cold.invoke_expect<&add>(2, 3) << std::endl;
+
+    //Compile-time stages are static bindings too
+    TDelegate<int(int, int)> _stage(stage<&add>());
+    std::cout << _stage.invoke_expect<&add>(4, 5) << std::endl;
+    return 0;
+}
+
  *   @endcode
  * 
  */
\ No newline at end of file
@@ -377,22 +377,379 @@ Exhibit B - "Incompatible With Secondary Licenses" Notice
  */
 
 #pragma once
+#include <algorithm>
+#include <cstdint>
+#include <initializer_list>
 #include <map>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include "EasyDelegateImpl.hpp"
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 namespace EasyDelegate
 {
+    /**
+     * @brief Waiter list of the containers that can't be awaited, it takes no space and no check on the call. 
+     * Awaitable containers use __DelegateWaiterList, see TAwaitableDelegateMulti in EasyDelegateCoroutineImpl.hpp.
+     * 
+     */
+    struct __NoDelegateWaiters
+    {
+        static constexpr bool bAwaitable = false;
+    };
+
+    //Defined in EasyDelegateCoroutineImpl.hpp
+    template<class _Values, auto eBase>
+    struct __DelegateNextAwaiter;
+
+    //Defined in EasyDelegateFrozenImpl.hpp
+    template<class _Enumerator, class _Signature, class _Comp, class _Policy>
+    class __FrozenDelegateMulti;
+
+    /**
+     * @brief Broadcast policy: every handler receives the rvalue arguments as const lvalue references, so no handler can move 
+     * from them and the container makes no copies. Lvalue arguments are passed as they are.
+     * 
+     */
+    struct __BroadcastConst
+    {
+        static constexpr bool bForwardLast{false};
+    };
+
+    /**
+     * @brief Broadcast policy: same as __BroadcastConst, but the last called handler receives the forwarded arguments 
+     * and can take ownership of the rvalues. Saves a copy for handlers taking arguments by value. Move-only arguments 
+     * taken by value can be passed only to the single attached handler, calls reaching more handlers throw std::logic_error 
+     * before any handler is called.
+     * 
+     */
+    struct __BroadcastForwardLast
+    {
+        static constexpr bool bForwardLast{true};
+    };
+
+    //Argument type passed to the handlers that share it
+    template<class _Arg>
+    using __SharedArgument = std::conditional_t<std::is_lvalue_reference<_Arg>::value, _Arg, const std::remove_reference_t<_Arg>&>;
+
+    //Index of the lowest set bit, value should not be zero
+    inline uint32_t _CountTrailingZeros(uint64_t value) noexcept
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward64(&index, value);
+        return static_cast<uint32_t>(index);
+#else
+        return static_cast<uint32_t>(__builtin_ctzll(value));
+#endif
+    }
+
+    //Index of the highest set bit, value should not be zero
+    inline uint32_t _HighestBit(uint64_t value) noexcept
+    {
+#if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanReverse64(&index, value);
+        return static_cast<uint32_t>(index);
+#else
+        return static_cast<uint32_t>(63 - __builtin_clzll(value));
+#endif
+    }
+
+    //Keys with the values below the bound are stored as bits and slots of their index, the others are kept sorted
+    constexpr uint32_t DelegateDenseKeys = 4096;
+
+    template<class _Enumerator>
+    [[nodiscard]] constexpr inline bool IsNegativeKey(_Enumerator key) noexcept
+    {
+        using underlying_t = std::underlying_type_t<_Enumerator>;
+        if constexpr (std::is_signed<underlying_t>::value)
+        {
+            return static_cast<underlying_t>(key) < 0;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    template<class _Enumerator>
+    [[nodiscard]] constexpr inline bool IsDenseKey(_Enumerator key) noexcept
+    {
+        using underlying_t = std::underlying_type_t<_Enumerator>;
+        return !IsNegativeKey(key) && static_cast<std::make_unsigned_t<underlying_t>>(key) < DelegateDenseKeys;
+    }
+
+    /**
+     * @brief Set of enumeration keys. Keys below DelegateDenseKeys are stored as bits of the key indices, 
+     * negative and large keys are kept in a sorted list, so sparse keys don't grow the bit words.
+     * 
+     * @tparam _Enumerator Enumerator class
+     */
+    template<class _Enumerator>
+    class __DelegateKeyMask
+    {
+    public:
+        __DelegateKeyMask() = default;
+
+        __DelegateKeyMask(std::initializer_list<_Enumerator> keys)
+        {
+            for (auto _key : keys)
+            {
+                set(_key);
+            }
+        }
+
+        inline __DelegateKeyMask& set(_Enumerator key)
+        {
+            if (!IsDenseKey(key))
+            {
+                const auto _position = std::lower_bound(m_Sparse.begin(), m_Sparse.end(), key);
+                if (_position == m_Sparse.end() || *_position != key)
+                {
+                    m_Sparse.insert(_position, key);
+                }
+                return *this;
+            }
+            const uint32_t _index = TakeKeyIndex(key);
+            if (_index / 64 >= m_Words.size())
+            {
+                m_Words.resize(_index / 64 + 1, 0);
+            }
+            m_Words[_index / 64] |= uint64_t{1} << (_index % 64);
+            return *this;
+        }
+
+        inline __DelegateKeyMask& reset(_Enumerator key) noexcept
+        {
+            if (!IsDenseKey(key))
+            {
+                const auto _position = std::lower_bound(m_Sparse.begin(), m_Sparse.end(), key);
+                if (_position != m_Sparse.end() && *_position == key)
+                {
+                    m_Sparse.erase(_position);
+                }
+                return *this;
+            }
+            const uint32_t _index = TakeKeyIndex(key);
+            if (_index / 64 < m_Words.size())
+            {
+                m_Words[_index / 64] &= ~(uint64_t{1} << (_index % 64));
+            }
+            return *this;
+        }
+
+        //Clears the keys of the other mask
+        inline __DelegateKeyMask& reset(const __DelegateKeyMask& other) noexcept
+        {
+            for (std::size_t _word = 0; _word < m_Words.size(); ++_word)
+            {
+                m_Words[_word] &= ~other.word(_word);
+            }
+            m_Sparse.erase(std::remove_if(m_Sparse.begin(), m_Sparse.end(), [&other](_Enumerator _key) { return other.test(_key); }), m_Sparse.end());
+            return *this;
+        }
+
+        inline __DelegateKeyMask& reset() noexcept
+        {
+            std::fill(m_Words.begin(), m_Words.end(), 0);
+            m_Sparse.clear();
+            return *this;
+        }
+
+        [[nodiscard]] inline bool test(_Enumerator key) const noexcept
+        {
+            if (!IsDenseKey(key))
+            {
+                return std::binary_search(m_Sparse.begin(), m_Sparse.end(), key);
+            }
+            const uint32_t _index = TakeKeyIndex(key);
+            return (word(_index / 64) >> (_index % 64)) & 1;
+        }
+
+        [[nodiscard]] inline bool none() const noexcept
+        {
+            for (auto _word : m_Words)
+            {
+                if (_word)
+                {
+                    return false;
+                }
+            }
+            return m_Sparse.empty();
+        }
+
+        [[nodiscard]] inline std::size_t count() const noexcept
+        {
+            std::size_t _count{m_Sparse.size()};
+            for (auto _word : m_Words)
+            {
+                for (; _word; _word &= _word - 1)
+                {
+                    ++_count;
+                }
+            }
+            return _count;
+        }
+
+        [[nodiscard]] inline std::size_t word_count() const noexcept
+        {
+            return m_Words.size();
+        }
+
+        //Words past the end are empty
+        [[nodiscard]] inline uint64_t word(std::size_t index) const noexcept
+        {
+            return index < m_Words.size() ? m_Words[index] : 0;
+        }
+
+        //Negative and large keys in key order, negative ones first
+        [[nodiscard]] inline const std::vector<_Enumerator>& sparse() const noexcept
+        {
+            return m_Sparse;
+        }
+
+        inline __DelegateKeyMask& operator|=(const __DelegateKeyMask& other)
+        {
+            if (other.m_Words.size() > m_Words.size())
+            {
+                m_Words.resize(other.m_Words.size(), 0);
+            }
+            for (std::size_t _word = 0; _word < other.m_Words.size(); ++_word)
+            {
+                m_Words[_word] |= other.m_Words[_word];
+            }
+            for (auto _key : other.m_Sparse)
+            {
+                set(_key);
+            }
+            return *this;
+        }
+
+        inline __DelegateKeyMask& operator&=(const __DelegateKeyMask& other) noexcept
+        {
+            for (std::size_t _word = 0; _word < m_Words.size(); ++_word)
+            {
+                m_Words[_word] &= other.word(_word);
+            }
+            m_Sparse.erase(std::remove_if(m_Sparse.begin(), m_Sparse.end(), [&other](_Enumerator _key) { return !other.test(_key); }), m_Sparse.end());
+            return *this;
+        }
+
+        friend inline __DelegateKeyMask operator|(__DelegateKeyMask left, const __DelegateKeyMask& right)
+        {
+            return left |= right;
+        }
+
+        friend inline __DelegateKeyMask operator&(__DelegateKeyMask left, const __DelegateKeyMask& right)
+        {
+            return left &= right;
+        }
+
+        /**
+         * @brief Calls the visitor with every key of the mask in key order
+         * 
+         * @tparam _Visitor Callable taking the key
+         * @param visitor 
+         */
+        template<class _Visitor>
+        inline void for_each(_Visitor&& visitor) const
+        {
+            const auto _middle = std::partition_point(m_Sparse.begin(), m_Sparse.end(), &IsNegativeKey<_Enumerator>);
+            for (auto _key = m_Sparse.begin(); _key != _middle; ++_key)
+            {
+                visitor(*_key);
+            }
+            for (std::size_t _word = 0; _word < m_Words.size(); ++_word)
+            {
+                for (uint64_t _bits = m_Words[_word]; _bits; _bits &= _bits - 1)
+                {
+                    const uint32_t _index = static_cast<uint32_t>(_word * 64) + _CountTrailingZeros(_bits);
+                    visitor(static_cast<_Enumerator>(static_cast<std::underlying_type_t<_Enumerator>>(_index)));
+                }
+            }
+            for (auto _key = _middle; _key != m_Sparse.end(); ++_key)
+            {
+                visitor(*_key);
+            }
+        }
+
+    private:
+        std::vector<uint64_t> m_Words;
+        std::vector<_Enumerator> m_Sparse;
+    };
+
+    /**
+     * @brief Returns the mask of the keys known at compile time, built once. Used to declare key categories.
+     * 
+     * @tparam eKeys User defined enumeration keys
+     * @return const __DelegateKeyMask& 
+     */
+    template<auto... eKeys>
+    inline const auto& key_mask()
+    {
+        static_assert(sizeof...(eKeys) > 0, "Key mask requires at least one key.");
+        using enumerator_t = std::common_type_t<decltype(eKeys)...>;
+        static const __DelegateKeyMask<enumerator_t> s_Mask{eKeys...};
+        return s_Mask;
+    }
+
+    //Checks whether the call arguments start with the key mask of the enumerator
+    template<class _Enumerator, class... Args>
+    struct __StartsWithKeyMask : std::false_type {};
+
+    template<class _Enumerator, class _First, class... Args>
+    struct __StartsWithKeyMask<_Enumerator, _First, Args...> : std::is_same<std::decay_t<_First>, __DelegateKeyMask<_Enumerator>> {};
+
+    template<class _Enumerator>
+    using TDelegateKeyMask = __DelegateKeyMask<_Enumerator>;
+
     /**
      * @brief Implementation of the ability to store multiple delegates with the same signature inside a single structure with a user-friendly interface
      * 
      * @tparam _Enumerator The enumerator class used for binding to a functional object
      * @tparam _Signature Signature of the function accepted by the delegate
      * @tparam _Comp Comparator for the enumerator
+     * @tparam _Policy Instrumentation policy, calls are recorded under the key index
+     * @tparam _Waiters List of the coroutines waiting for the keys, __NoDelegateWaiters unless the container is awaitable
      */
-    template<class _Enumerator, class _Signature, class _Comp>
-    class __DelegateMulti
+    template<class _Enumerator, class _Signature, class _Comp, class _Policy, class _Waiters = __NoDelegateWaiters>
+    class __DelegateMulti : private _Waiters
     {
     public:
+        __DelegateMulti() = default;
+
+        /**
+         * @brief Copies the delegates and the masks. Waiting coroutines stay with the original.
+         * 
+         * @param other 
+         */
+        __DelegateMulti(const __DelegateMulti& other) : _Waiters(), m_Delegates(other.m_Delegates), m_Attached(other.m_Attached), m_Disabled(other.m_Disabled)
+        {
+            _Relink();
+        }
+
+        __DelegateMulti& operator=(const __DelegateMulti& other)
+        {
+            if (this != &other)
+            {
+                m_Delegates = other.m_Delegates;
+                m_Attached = other.m_Attached;
+                m_Disabled = other.m_Disabled;
+                _Relink();
+            }
+            return *this;
+        }
+
+        //Map nodes are moved with the map, so the slot table stays valid. Waiting coroutines stay with the original.
+        __DelegateMulti(__DelegateMulti&&) = default;
+        __DelegateMulti& operator=(__DelegateMulti&&) = default;
+
         /**
          * @brief Attaching existing delegate if signature is same
          * 
@@ -403,9 +760,9 @@ namespace EasyDelegate
         inline void attach(__Delegate<_Signature>&& _delegate)
         {
             static_assert(std::is_same<
-            std::remove_reference<decltype(_delegate)>::type, __Delegate<_Signature>>::value,
+            typename std::remove_reference<decltype(_delegate)>::type, __Delegate<_Signature>>::value,
             "Attached delegate has diferent signatures." );
-            m_Delegates.try_emplace(eBase, std::move(_delegate));
+            _Link(eBase, m_Delegates.try_emplace(eBase, std::move(_delegate)).first->second);
         }
 
         /**
@@ -420,7 +777,7 @@ namespace EasyDelegate
         {
             __Delegate<_Signature> _delegate;
             _delegate.attach(std::forward<_LabbdaFunction>(lfunc));
-            m_Delegates.emplace(eBase, std::move(_delegate));
+            _Link(eBase, m_Delegates.emplace(eBase, std::move(_delegate)).first->second);
         }
 
         /**
@@ -435,7 +792,7 @@ namespace EasyDelegate
         {
             __Delegate<_Signature> _delegate;
             _delegate.attach(std::forward<Args>(args)...);
-            m_Delegates.emplace(eBase, std::move(_delegate));
+            _Link(eBase, m_Delegates.emplace(eBase, std::move(_delegate)).first->second);
         }
 
         /**
@@ -447,10 +804,98 @@ namespace EasyDelegate
         inline void detach()
         {
             m_Delegates.erase(eBase);
+            m_Attached.reset(eBase);
+            if (IsDenseKey(eBase) && TakeKeyIndex(eBase) < m_Slots.size())
+            {
+                m_Slots[TakeKeyIndex(eBase)] = nullptr;
+            }
+        }
+
+        /**
+         * @brief Unmutes the key. Keys are enabled by default, the state is kept when the delegate is detached.
+         * 
+         * @tparam eBase User defined enumeration key
+         */
+        template<_Enumerator eBase>
+        inline void enable() noexcept
+        {
+            m_Disabled.reset(eBase);
+        }
+
+        /**
+         * @brief Mutes the key without detaching the delegate. Muted keys are skipped by execute and eval of all delegates 
+         * and by execute of the key, eval of the key still calls the delegate.
+         * 
+         * @tparam eBase User defined enumeration key
+         */
+        template<_Enumerator eBase>
+        inline void disable()
+        {
+            m_Disabled.set(eBase);
+        }
+
+        /**
+         * @brief Checks whether the key is not muted
+         * 
+         * @tparam eBase User defined enumeration key
+         */
+        template<_Enumerator eBase>
+        [[nodiscard]] inline bool enabled() const noexcept
+        {
+            return !m_Disabled.test(eBase);
+        }
+
+        /**
+         * @brief Unmutes all the keys of the mask
+         * 
+         * @param mask Keys to unmute
+         */
+        inline void enable(const __DelegateKeyMask<_Enumerator>& mask) noexcept
+        {
+            m_Disabled.reset(mask);
+        }
+
+        /**
+         * @brief Mutes all the keys of the mask
+         * 
+         * @param mask Keys to mute
+         */
+        inline void disable(const __DelegateKeyMask<_Enumerator>& mask)
+        {
+            m_Disabled |= mask;
+        }
+
+        /**
+         * @brief Unmutes every key
+         * 
+         */
+        inline void enable_all() noexcept
+        {
+            m_Disabled.reset();
+        }
+
+        /**
+         * @brief Mutes every attached key
+         * 
+         */
+        inline void disable_all()
+        {
+            m_Disabled |= m_Attached;
+        }
+
+        /**
+         * @brief Returns keys of the attached delegates that are not muted
+         * 
+         */
+        [[nodiscard]] inline __DelegateKeyMask<_Enumerator> enabled_mask() const
+        {
+            auto _mask = m_Attached;
+            return _mask.reset(m_Disabled);
         }
 
         /**
-         * @brief Executes the delegate for the specified enumerator
+         * @brief Executes the delegate for the specified enumerator. Muted keys are skipped. 
+         * Throws std::bad_function_call if the delegate was not attached, unless a coroutine of the awaitable container waits for the key.
          * 
          * @tparam eBase User defined enumeration key
          * @tparam Args Templated std::tuple arguments 
@@ -463,33 +908,68 @@ namespace EasyDelegate
             //Checking for the correctness of the type used
             static_assert(std::is_same<return_type, void>::value, "Trying to execute delegates with return type 'non-void'. For 'non-void' you should use 'eval' method.");
 
-            m_Delegates[eBase](std::forward<Args>(args)...);
+            if (m_Disabled.test(eBase))
+            {
+                return;
+            }
+
+            __Delegate<_Signature>* _delegate = _Find(eBase);
+            if (!_delegate || !*_delegate)
+            {
+                //Event without attached delegate still resumes the waiting coroutines
+                if constexpr (_Waiters::bAwaitable && std::is_copy_constructible<value_type>::value)
+                {
+                    if (this->_Waits(TakeKeyIndex(eBase)))
+                    {
+                        const value_type _values(std::as_const(args)...);
+                        this->_Notify(TakeKeyIndex(eBase), &_values);
+                        return;
+                    }
+                }
+                throw std::bad_function_call();
+            }
+            _Call(TakeKeyIndex(eBase), *_delegate, std::forward<Args>(args)...);
         }
 
         /**
-         * @brief Executes all the delegates that were attached to the object
+         * @brief Executes all the delegates that were attached to the object and are not muted, in order of the comparator. 
+         * Arguments are forwarded at most once, see __BroadcastConst.
          * 
+         * @tparam _Broadcast Broadcast policy, __BroadcastConst or __BroadcastForwardLast
          * @tparam Args Templated std::tuple arguments 
          * @param args Delegate arguments
          */
-        template<class ...Args>
-        inline void execute(Args&&... args)
+        template<class _Broadcast = __BroadcastConst, class ...Args>
+        inline auto execute(Args&&... args) -> std::enable_if_t<!__StartsWithKeyMask<_Enumerator, Args...>::value>
         {
             using return_type = typename __SignatureDesc<_Signature>::return_type;
             //Checking for the correctness of the type used 
             static_assert(std::is_same<return_type, void>::value, "Trying to execute delegates with return type 'non-void'. For 'non-void' you should use 'eval' method.");
 
-            for (auto &[_key, _delegate] : m_Delegates)
-            {
-                if (_delegate)
-                {
-                    _delegate(std::forward<Args>(args)...);
-                }
-            }
+            _Dispatch<_Broadcast>(nullptr, [](const _Enumerator&) {}, std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Executes the delegates of the keys in the mask that were attached and are not muted, in order of the comparator. 
+         * Only the words of the mask are scanned.
+         * 
+         * @tparam _Broadcast Broadcast policy, __BroadcastConst or __BroadcastForwardLast
+         * @tparam Args Templated std::tuple arguments 
+         * @param mask Category of the keys, see key_mask
+         * @param args Delegate arguments
+         */
+        template<class _Broadcast = __BroadcastConst, class ...Args>
+        inline void execute(const __DelegateKeyMask<_Enumerator>& mask, Args&&... args)
+        {
+            using return_type = typename __SignatureDesc<_Signature>::return_type;
+            static_assert(std::is_same<return_type, void>::value, "Trying to execute delegates with return type 'non-void'. For 'non-void' you should use 'eval' method.");
+
+            _Dispatch<_Broadcast>(&mask, [](const _Enumerator&) {}, std::forward<Args>(args)...);
         }
 
         /**
-         * @brief Evaluates the delegate on the specified enumerator and returns the value
+         * @brief Evaluates the delegate on the specified enumerator and returns the value. 
+         * Throws std::bad_function_call if the delegate was not attached or the key is muted, there is no value to return.
          * 
          * @tparam eBase User defined enumeration key
          * @tparam Args Templated std::tuple arguments 
@@ -502,37 +982,77 @@ namespace EasyDelegate
             using return_type = typename __SignatureDesc<_Signature>::return_type;
             static_assert(!std::is_same<return_type, void>::value, "Trying to evaluate delegates with return type 'void'. For 'void' you should use 'execute' method.");
 
-            return m_Delegates[eBase](std::forward<Args>(args)...);
+            return _Call(TakeKeyIndex(eBase), _Require(eBase), std::forward<Args>(args)...);
         }
         
         /**
          * @brief Executes all the delegates attached to the object and returns the std::map object containing the calculation results. You can also refer to the result by the numerator.
+         * Muted keys are skipped.
+         * Arguments are forwarded at most once, see __BroadcastConst.
          * 
+         * @tparam _Broadcast Broadcast policy, __BroadcastConst or __BroadcastForwardLast
          * @tparam Args Templated std::tuple arguments 
          * @param args Delegate arguments
          * @return std::map<_Enumerator, return_type> 
          */
-        template<class ...Args>
-        inline auto eval(Args&&... args) -> typename std::map<_Enumerator, 
-        typename __SignatureDesc<_Signature>::return_type>
+        template<class _Broadcast = __BroadcastConst, class ...Args>
+        inline auto eval(Args&&... args) -> std::enable_if_t<!__StartsWithKeyMask<_Enumerator, Args...>::value, 
+        std::map<_Enumerator, typename __SignatureDesc<_Signature>::return_type>>
         {
             using return_type = typename __SignatureDesc<_Signature>::return_type;
             static_assert(!std::is_same<return_type, void>::value, "Trying to evaluate delegates with return type 'void'. For 'void' you should use 'execute' method.");
             std::map<_Enumerator, return_type> _results;
 
-            for (auto &[_key, _delegate] : m_Delegates)
-            {
-                if (_delegate)
-                {
-                    _results.emplace(_key, _delegate(std::forward<Args>(args)...));
-                }
-            }
+            _Dispatch<_Broadcast>(nullptr, [&_results](const _Enumerator& _key, return_type&& _result) { _results.emplace(_key, std::move(_result)); }, std::forward<Args>(args)...);
 
             return std::forward<decltype(_results)>(_results);
         }
 
         /**
-         * @brief Illegal in any c++ standart
+         * @brief Evaluates the delegates of the keys in the mask that were attached and are not muted
+         * 
+         * @tparam _Broadcast Broadcast policy, __BroadcastConst or __BroadcastForwardLast
+         * @tparam Args Templated std::tuple arguments 
+         * @param mask Category of the keys, see key_mask
+         * @param args Delegate arguments
+         * @return std::map<_Enumerator, return_type> 
+         */
+        template<class _Broadcast = __BroadcastConst, class ...Args>
+        inline auto eval(const __DelegateKeyMask<_Enumerator>& mask, Args&&... args) -> std::map<_Enumerator, typename __SignatureDesc<_Signature>::return_type>
+        {
+            using return_type = typename __SignatureDesc<_Signature>::return_type;
+            static_assert(!std::is_same<return_type, void>::value, "Trying to evaluate delegates with return type 'void'. For 'void' you should use 'execute' method.");
+            std::map<_Enumerator, return_type> _results;
+
+            _Dispatch<_Broadcast>(&mask, [&_results](const _Enumerator& _key, return_type&& _result) { _results.emplace(_key, std::move(_result)); }, std::forward<Args>(args)...);
+
+            return _results;
+        }
+
+        /**
+         * @brief Invokes the delegate for the specified enumerator on the library thread pool. The container should outlive the returned future. 
+         * Throws std::bad_function_call in the calling thread if the delegate was not attached or the key is muted.
+         * 
+         * @tparam eBase User defined enumeration key
+         * @tparam Args Templated std::tuple arguments 
+         * @param args Delegate arguments, stored by value until the call
+         * @return Future of the call result, waits for the call on destruction
+         */
+        template<_Enumerator eBase, class ...Args>
+        [[nodiscard]] inline auto invoke_async(Args&&... args)
+        {
+            //Delegate is looked up in the calling thread, the worker only calls it
+            auto* _delegate = &_Require(eBase);
+            return __DelegateAsyncPool<Args...>::type::instance().submit([_delegate](auto&&... _args) -> typename __SignatureDesc<_Signature>::return_type
+            {
+                typename _Policy::scope _scope(TakeKeyIndex(eBase));
+                return (*_delegate)(std::forward<decltype(_args)>(_args)...);
+            }, std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Illegal in any c++ standart. Same as execute<eBase> for 'void' signatures and eval<eBase> for the others, 
+         * so muted keys are skipped or throw std::bad_function_call.
          * 
          * @tparam eBase 
          * @tparam Args 
@@ -542,14 +1062,291 @@ namespace EasyDelegate
         template<_Enumerator eBase, class ...Args>
         inline auto operator()(Args&&... args) -> typename __SignatureDesc<_Signature>::return_type
         {
-            return m_Delegates[eBase](std::forward<Args>(args)...);
+            if constexpr (std::is_void<return_type>::value)
+            {
+                execute<eBase>(std::forward<Args>(args)...);
+            }
+            else
+            {
+                return eval<eBase>(std::forward<Args>(args)...);
+            }
         }
+        /**
+         * @brief Returns awaitable that resumes the coroutine on the next call of the key with the call arguments. 
+         * Available on TAwaitableDelegateMulti from EasyDelegateCoroutineImpl.hpp, copies and moved-to containers start without waiters.
+         * 
+         * @tparam eBase User defined enumeration key
+         */
+        template<_Enumerator eBase>
+        [[nodiscard]] inline auto next() noexcept
+        {
+            static_assert(_Waiters::bAwaitable, "Awaiting keys requires TAwaitableDelegateMulti from EasyDelegateCoroutineImpl.hpp.");
+            static_assert(std::is_copy_constructible<value_type>::value, "Awaited arguments should be copyable.");
+            return __DelegateNextAwaiter<value_type, eBase>{static_cast<_Waiters&>(*this)};
+        }
+
+        /**
+         * @brief Returns read-only copy of the attached and enabled delegates with contiguous storage and dense key index. 
+         * The copy can be shared between threads without synchronization, the container stays unchanged.
+         * 
+         * @return __FrozenDelegateMulti<_Enumerator, _Signature, _Comp, _Policy> 
+         */
+        [[nodiscard]] inline auto freeze() const
+        {
+            std::vector<std::pair<_Enumerator, __Delegate<_Signature>>> _entries;
+            if constexpr (!s_KeyOrder)
+            {
+                //Table keeps the order of the comparator
+                for (const auto& [_key, _delegate] : m_Delegates)
+                {
+                    if (_delegate && !m_Disabled.test(_key))
+                    {
+                        _entries.emplace_back(_key, _delegate);
+                    }
+                }
+            }
+            else
+            {
+                enabled_mask().for_each([this, &_entries](_Enumerator _key)
+                {
+                    const auto _found = m_Delegates.find(_key);
+                    if (_found != m_Delegates.end() && _found->second)
+                    {
+                        _entries.emplace_back(_key, _found->second);
+                    }
+                });
+            }
+            return __FrozenDelegateMulti<_Enumerator, _Signature, _Comp, _Policy>(std::move(_entries));
+        }
+
     private:
+        using value_type = typename __SignatureDesc<_Signature>::value_type;
+        using return_type = typename __SignatureDesc<_Signature>::return_type;
+
+        //Default comparator orders the keys by value, so the bits of the masks can be scanned instead of the map
+        static constexpr bool s_KeyOrder = std::is_same<_Comp, __EnumeratorComp<_Enumerator>>::value;
+
+        //Resumes waiters of the key after the delegate returned
+        struct __WaiterNotify
+        {
+            ~__WaiterNotify()
+            {
+                owner._Notify(key, &values);
+            }
+
+            _Waiters& owner;
+            uint32_t key;
+            value_type values;
+        };
+
+        template<class ...Args>
+        inline return_type _Call(uint32_t key, __Delegate<_Signature>& _delegate, Args&&... args)
+        {
+            //Move-only arguments can't be awaited, next() rejects them
+            if constexpr (_Waiters::bAwaitable && std::is_copy_constructible<value_type>::value)
+            {
+                //Arguments are copied only when a coroutine waits for this key
+                if (this->_Waits(key))
+                {
+                    //Arguments are captured before the delegate can move from them
+                    __WaiterNotify _notify{*this, key, value_type(std::as_const(args)...)};
+                    typename _Policy::scope _scope(key);
+                    return _delegate(std::forward<Args>(args)...);
+                }
+            }
+            typename _Policy::scope _scope(key);
+            return _delegate(std::forward<Args>(args)...);
+        }
+
+        //Calls every attached delegate and passes the key with the result to the sink
+        template<class _Mode, class _Sink, class ...Args>
+        inline void _Dispatch(const __DelegateKeyMask<_Enumerator>* filter, _Sink&& sink, Args&&... args)
+        {
+            constexpr bool bShared = std::is_invocable<std::function<_Signature>&, __SharedArgument<Args>...>::value;
+            static_assert(bShared || _Mode::bForwardLast, "Arguments can't be shared between handlers. Take them by const reference or use __BroadcastForwardLast.");
+
+            std::size_t _handlers{0};
+            _Enumerator _last{};
+            if constexpr (_Mode::bForwardLast)
+            {
+                _ForEachActive(filter, [&_handlers, &_last](_Enumerator _key, __Delegate<_Signature>&)
+                {
+                    ++_handlers;
+                    _last = _key;
+                });
+            }
+            if constexpr (!bShared)
+            {
+                //Move-only arguments reach one handler only, the call is rejected before any handler runs
+                if (_handlers > 1)
+                {
+                    throw std::logic_error("Move-only arguments can be passed only to the single handler.");
+                }
+            }
+
+            _ForEachActive(filter, [&](_Enumerator _key, __Delegate<_Signature>& _delegate)
+            {
+                if (_handlers && _key == _last)
+                {
+                    _Deliver(sink, _key, _delegate, std::forward<Args>(args)...);
+                }
+                else if constexpr (bShared)
+                {
+                    _Deliver(sink, _key, _delegate, static_cast<__SharedArgument<Args>>(args)...);
+                }
+                else
+                {
+                    //Handler attached another one during the call
+                    throw std::logic_error("Move-only arguments can be passed only to the single handler.");
+                }
+            });
+        }
+
+        //Visits the attached, not muted keys of the filter in order of the comparator. Keys ordered by value are taken 
+        //from the masks: negative keys, bits of the dense keys, large keys
+        template<class _Visitor>
+        inline void _ForEachActive(const __DelegateKeyMask<_Enumerator>* filter, _Visitor&& visitor)
+        {
+            if constexpr (!s_KeyOrder)
+            {
+                for (auto _next = m_Delegates.begin(); _next != m_Delegates.end();)
+                {
+                    const _Enumerator _key = _next->first;
+                    if (_next->second && !m_Disabled.test(_key) && (!filter || filter->test(_key)))
+                    {
+                        visitor(_key, _next->second);
+                    }
+                    //Handlers can attach and detach keys, the map is searched again after the call
+                    _next = m_Delegates.upper_bound(_key);
+                }
+                return;
+            }
+
+            _ForEachSparse(filter, true, visitor);
+
+            //Only set bits of the attached and not muted keys are visited
+            const std::size_t _count = filter ? std::min(m_Attached.word_count(), filter->word_count()) : m_Attached.word_count();
+            for (std::size_t _word = 0; _word < _count; ++_word)
+            {
+                for (uint64_t _bits = _ActiveWord(_word, filter); _bits; _bits &= _bits - 1)
+                {
+                    const uint32_t _index = static_cast<uint32_t>(_word * 64) + _CountTrailingZeros(_bits);
+                    //Delegate can be detached by the previous handler
+                    __Delegate<_Signature>* _delegate = m_Slots[_index];
+                    if (_delegate && *_delegate)
+                    {
+                        visitor(static_cast<_Enumerator>(static_cast<std::underlying_type_t<_Enumerator>>(_index)), *_delegate);
+                    }
+                }
+            }
+
+            _ForEachSparse(filter, false, visitor);
+        }
+
+        template<class _Visitor>
+        inline void _ForEachSparse(const __DelegateKeyMask<_Enumerator>* filter, bool bNegative, _Visitor& visitor)
+        {
+            const auto& _sparse = m_Attached.sparse();
+            auto _next = bNegative ? _sparse.begin() : std::partition_point(_sparse.begin(), _sparse.end(), &IsNegativeKey<_Enumerator>);
+            while (_next != _sparse.end() && IsNegativeKey(*_next) == bNegative)
+            {
+                const _Enumerator _key = *_next;
+                if (!m_Disabled.test(_key) && (!filter || filter->test(_key)))
+                {
+                    const auto _found = m_Delegates.find(_key);
+                    if (_found != m_Delegates.end() && _found->second)
+                    {
+                        visitor(_key, _found->second);
+                    }
+                }
+                //Handlers can attach and detach keys, the list is searched again after the call
+                _next = std::upper_bound(_sparse.begin(), _sparse.end(), _key);
+            }
+        }
+
+        inline uint64_t _ActiveWord(std::size_t word, const __DelegateKeyMask<_Enumerator>* filter) const noexcept
+        {
+            const uint64_t _active = m_Attached.word(word) & ~m_Disabled.word(word);
+            return filter ? _active & filter->word(word) : _active;
+        }
+
+        //Looks up the delegate of the key without inserting it into the map, sparse keys are searched in the map
+        inline __Delegate<_Signature>* _Find(_Enumerator key) noexcept
+        {
+            if (!IsDenseKey(key))
+            {
+                const auto _found = m_Delegates.find(key);
+                return _found != m_Delegates.end() ? &_found->second : nullptr;
+            }
+            const uint32_t _index = TakeKeyIndex(key);
+            return _index < m_Slots.size() ? m_Slots[_index] : nullptr;
+        }
+
+        //Delegate of the key for the calls that need one, missing delegate or muted key throws like the empty one
+        inline __Delegate<_Signature>& _Require(_Enumerator key)
+        {
+            __Delegate<_Signature>* _delegate = m_Disabled.test(key) ? nullptr : _Find(key);
+            if (!_delegate || !*_delegate)
+            {
+                throw std::bad_function_call();
+            }
+            return *_delegate;
+        }
+
+        inline void _Link(_Enumerator key, __Delegate<_Signature>& _delegate)
+        {
+            m_Attached.set(key);
+            if (!IsDenseKey(key))
+            {
+                return;
+            }
+            const uint32_t _index = TakeKeyIndex(key);
+            if (_index >= m_Slots.size())
+            {
+                m_Slots.resize(_index + 1, nullptr);
+            }
+            m_Slots[_index] = &_delegate;
+        }
+
+        //Points the slot table to the own map nodes
+        inline void _Relink()
+        {
+            m_Slots.assign(m_Slots.size(), nullptr);
+            for (auto& [_key, _delegate] : m_Delegates)
+            {
+                if (m_Attached.test(_key))
+                {
+                    _Link(_key, _delegate);
+                }
+            }
+        }
+
+        template<class _Sink, class ...Args>
+        inline void _Deliver(_Sink& sink, const _Enumerator& _key, __Delegate<_Signature>& _delegate, Args&&... args)
+        {
+            if constexpr (std::is_void<return_type>::value)
+            {
+                _Call(TakeKeyIndex(_key), _delegate, std::forward<Args>(args)...);
+                sink(_key);
+            }
+            else
+            {
+                sink(_key, _Call(TakeKeyIndex(_key), _delegate, std::forward<Args>(args)...));
+            }
+        }
+
         std::map<_Enumerator, __Delegate<_Signature>, _Comp> m_Delegates;
+        //Attached delegates by index of the dense keys, map nodes never move
+        std::vector<__Delegate<_Signature>*> m_Slots;
+        __DelegateKeyMask<_Enumerator> m_Attached;
+        __DelegateKeyMask<_Enumerator> m_Disabled;
     };
 
-    template<class _Enumerator, class _Signature, class _Comp = __EnumeratorComp<_Enumerator>>
-    using TDelegateMulti = __DelegateMulti<_Enumerator, _Signature, _Comp>;
+    template<class _Enumerator, class _Signature, class _Comp = __EnumeratorComp<_Enumerator>, class _Policy = __NoInstrumentation>
+    using TDelegateMulti = __DelegateMulti<_Enumerator, _Signature, _Comp, _Policy>;
+
+    using TBroadcastConst = __BroadcastConst;
+    using TBroadcastForwardLast = __BroadcastForwardLast;
 }
 
 /**
@@ -645,4 +1442,58 @@ int main()
 }
  * @endcode
  * 
+ */
+/**
+ * @example CategoryExample
+ * 
+ * @code
+#include <iostream>
+#include "EasyDelegate.hpp"
+
+using namespace EasyDelegate;
+
+enum class ESubsystem
+{
+    ESocket,
+    EReplication,
+    EMixer,
+    EMusic,
+    ERenderer
+};
+
+//Categories are declared once and shared by all the containers
+const auto& g_Network = key_mask<ESubsystem::ESocket, ESubsystem::EReplication>();
+const auto& g_Audio = key_mask<ESubsystem::EMixer, ESubsystem::EMusic>();
+
+int main()
+{
+    TDelegateMulti<ESubsystem, void(float)> _update;
+    _update.attach<ESubsystem::ESocket>([](float delta) { std::cout << "socket " << delta << std::endl; });
+    _update.attach<ESubsystem::EReplication>([](float delta) { std::cout << "replication " << delta << std::endl; });
+    _update.attach<ESubsystem::EMixer>([](float delta) { std::cout << "mixer " << delta << std::endl; });
+    _update.attach<ESubsystem::EMusic>([](float delta) { std::cout << "music " << delta << std::endl; });
+    _update.attach<ESubsystem::ERenderer>([](float delta) { std::cout << "renderer " << delta << std::endl; });
+
+    //Only the network handlers, in order of the keys
+    _update.execute(g_Network, 0.016f);
+
+    //Muted handlers are skipped inside the category
+    _update.disable<ESubsystem::EMusic>();
+    _update.execute(g_Audio, 0.016f);
+
+    //Categories can be combined
+    _update.execute(g_Network | g_Audio, 0.033f);
+
+    TDelegateMulti<ESubsystem, int(int)> _budget;
+    _budget.attach<ESubsystem::EMixer>([](int frame) { return frame * 2; });
+    _budget.attach<ESubsystem::ERenderer>([](int frame) { return frame * 8; });
+    for (auto& [_key, _value] : _budget.eval(g_Audio, 10))
+    {
+        std::cout << "audio budget " << static_cast<int>(_key) << ": " << _value << std::endl;
+    }
+    return 0;
+}
+
+ *   @endcode
+ * 
  */
\ No newline at end of file
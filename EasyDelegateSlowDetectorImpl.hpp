@@ -0,0 +1,669 @@
+/**
+Mozilla Public License Version 2.0
+==================================
+
+Copyright (c) 2021 AdamFull && range36rus
+
+1. Definitions
+--------------
+
+1.1. "Contributor"
+    means each individual or legal entity that creates, contributes to
+    the creation of, or owns Covered Software.
+
+1.2. "Contributor Version"
+    means the combination of the Contributions of others (if any) used
+    by a Contributor and that particular Contributor's Contribution.
+
+1.3. "Contribution"
+    means Covered Software of a particular Contributor.
+
+1.4. "Covered Software"
+    means Source Code Form to which the initial Contributor has attached
+    the notice in Exhibit A, the Executable Form of such Source Code
+    Form, and Modifications of such Source Code Form, in each case
+    including portions thereof.
+
+1.5. "Incompatible With Secondary Licenses"
+    means
+
+    (a) that the initial Contributor has attached the notice described
+        in Exhibit B to the Covered Software; or
+
+    (b) that the Covered Software was made available under the terms of
+        version 1.1 or earlier of the License, but not also under the
+        terms of a Secondary License.
+
+1.6. "Executable Form"
+    means any form of the work other than Source Code Form.
+
+1.7. "Larger Work"
+    means a work that combines Covered Software with other material, in
+    a separate file or files, that is not Covered Software.
+
+1.8. "License"
+    means this document.
+
+1.9. "Licensable"
+    means having the right to grant, to the maximum extent possible,
+    whether at the time of the initial grant or subsequently, any and
+    all of the rights conveyed by this License.
+
+1.10. "Modifications"
+    means any of the following:
+
+    (a) any file in Source Code Form that results from an addition to,
+        deletion from, or modification of the contents of Covered
+        Software; or
+
+    (b) any new file in Source Code Form that contains any Covered
+        Software.
+
+1.11. "Patent Claims" of a Contributor
+    means any patent claim(s), including without limitation, method,
+    process, and apparatus claims, in any patent Licensable by such
+    Contributor that would be infringed, but for the grant of the
+    License, by the making, using, selling, offering for sale, having
+    made, import, or transfer of either its Contributions or its
+    Contributor Version.
+
+1.12. "Secondary License"
+    means either the GNU General Public License, Version 2.0, the GNU
+    Lesser General Public License, Version 2.1, the GNU Affero General
+    Public License, Version 3.0, or any later versions of those
+    licenses.
+
+1.13. "Source Code Form"
+    means the form of the work preferred for making modifications.
+
+1.14. "You" (or "Your")
+    means an individual or a legal entity exercising rights under this
+    License. For legal entities, "You" includes any entity that
+    controls, is controlled by, or is under common control with You. For
+    purposes of this definition, "control" means (a) the power, direct
+    or indirect, to cause the direction or management of such entity,
+    whether by contract or otherwise, or (b) ownership of more than
+    fifty percent (50%) of the outstanding shares or beneficial
+    ownership of such entity.
+
+2. License Grants and Conditions
+--------------------------------
+
+2.1. Grants
+
+Each Contributor hereby grants You a world-wide, royalty-free,
+non-exclusive license:
+
+(a) under intellectual property rights (other than patent or trademark)
+    Licensable by such Contributor to use, reproduce, make available,
+    modify, display, perform, distribute, and otherwise exploit its
+    Contributions, either on an unmodified basis, with Modifications, or
+    as part of a Larger Work; and
+
+(b) under Patent Claims of such Contributor to make, use, sell, offer
+    for sale, have made, import, and otherwise transfer either its
+    Contributions or its Contributor Version.
+
+2.2. Effective Date
+
+The licenses granted in Section 2.1 with respect to any Contribution
+become effective for each Contribution on the date the Contributor first
+distributes such Contribution.
+
+2.3. Limitations on Grant Scope
+
+The licenses granted in this Section 2 are the only rights granted under
+this License. No additional rights or licenses will be implied from the
+distribution or licensing of Covered Software under this License.
+Notwithstanding Section 2.1(b) above, no patent license is granted by a
+Contributor:
+
+(a) for any code that a Contributor has removed from Covered Software;
+    or
+
+(b) for infringements caused by: (i) Your and any other third party's
+    modifications of Covered Software, or (ii) the combination of its
+    Contributions with other software (except as part of its Contributor
+    Version); or
+
+(c) under Patent Claims infringed by Covered Software in the absence of
+    its Contributions.
+
+This License does not grant any rights in the trademarks, service marks,
+or logos of any Contributor (except as may be necessary to comply with
+the notice requirements in Section 3.4).
+
+2.4. Subsequent Licenses
+
+No Contributor makes additional grants as a result of Your choice to
+distribute the Covered Software under a subsequent version of this
+License (see Section 10.2) or under the terms of a Secondary License (if
+permitted under the terms of Section 3.3).
+
+2.5. Representation
+
+Each Contributor represents that the Contributor believes its
+Contributions are its original creation(s) or it has sufficient rights
+to grant the rights to its Contributions conveyed by this License.
+
+2.6. Fair Use
+
+This License is not intended to limit any rights You have under
+applicable copyright doctrines of fair use, fair dealing, or other
+equivalents.
+
+2.7. Conditions
+
+Sections 3.1, 3.2, 3.3, and 3.4 are conditions of the licenses granted
+in Section 2.1.
+
+3. Responsibilities
+-------------------
+
+3.1. Distribution of Source Form
+
+All distribution of Covered Software in Source Code Form, including any
+Modifications that You create or to which You contribute, must be under
+the terms of this License. You must inform recipients that the Source
+Code Form of the Covered Software is governed by the terms of this
+License, and how they can obtain a copy of this License. You may not
+attempt to alter or restrict the recipients' rights in the Source Code
+Form.
+
+3.2. Distribution of Executable Form
+
+If You distribute Covered Software in Executable Form then:
+
+(a) such Covered Software must also be made available in Source Code
+    Form, as described in Section 3.1, and You must inform recipients of
+    the Executable Form how they can obtain a copy of such Source Code
+    Form by reasonable means in a timely manner, at a charge no more
+    than the cost of distribution to the recipient; and
+
+(b) You may distribute such Executable Form under the terms of this
+    License, or sublicense it under different terms, provided that the
+    license for the Executable Form does not attempt to limit or alter
+    the recipients' rights in the Source Code Form under this License.
+
+3.3. Distribution of a Larger Work
+
+You may create and distribute a Larger Work under terms of Your choice,
+provided that You also comply with the requirements of this License for
+the Covered Software. If the Larger Work is a combination of Covered
+Software with a work governed by one or more Secondary Licenses, and the
+Covered Software is not Incompatible With Secondary Licenses, this
+License permits You to additionally distribute such Covered Software
+under the terms of such Secondary License(s), so that the recipient of
+the Larger Work may, at their option, further distribute the Covered
+Software under the terms of either this License or such Secondary
+License(s).
+
+3.4. Notices
+
+You may not remove or alter the substance of any license notices
+(including copyright notices, patent notices, disclaimers of warranty,
+or limitations of liability) contained within the Source Code Form of
+the Covered Software, except that You may alter any license notices to
+the extent required to remedy known factual inaccuracies.
+
+3.5. Application of Additional Terms
+
+You may choose to offer, and to charge a fee for, warranty, support,
+indemnity or liability obligations to one or more recipients of Covered
+Software. However, You may do so only on Your own behalf, and not on
+behalf of any Contributor. You must make it absolutely clear that any
+such warranty, support, indemnity, or liability obligation is offered by
+You alone, and You hereby agree to indemnify every Contributor for any
+liability incurred by such Contributor as a result of warranty, support,
+indemnity or liability terms You offer. You may include additional
+disclaimers of warranty and limitations of liability specific to any
+jurisdiction.
+
+4. Inability to Comply Due to Statute or Regulation
+---------------------------------------------------
+
+If it is impossible for You to comply with any of the terms of this
+License with respect to some or all of the Covered Software due to
+statute, judicial order, or regulation then You must: (a) comply with
+the terms of this License to the maximum extent possible; and (b)
+describe the limitations and the code they affect. Such description must
+be placed in a text file included with all distributions of the Covered
+Software under this License. Except to the extent prohibited by statute
+or regulation, such description must be sufficiently detailed for a
+recipient of ordinary skill to be able to understand it.
+
+5. Termination
+--------------
+
+5.1. The rights granted under this License will terminate automatically
+if You fail to comply with any of its terms. However, if You become
+compliant, then the rights granted under this License from a particular
+Contributor are reinstated (a) provisionally, unless and until such
+Contributor explicitly and finally terminates Your grants, and (b) on an
+ongoing basis, if such Contributor fails to notify You of the
+non-compliance by some reasonable means prior to 60 days after You have
+come back into compliance. Moreover, Your grants from a particular
+Contributor are reinstated on an ongoing basis if such Contributor
+notifies You of the non-compliance by some reasonable means, this is the
+first time You have received notice of non-compliance with this License
+from such Contributor, and You become compliant prior to 30 days after
+Your receipt of the notice.
+
+5.2. If You initiate litigation against any entity by asserting a patent
+infringement claim (excluding declaratory judgment actions,
+counter-claims, and cross-claims) alleging that a Contributor Version
+directly or indirectly infringes any patent, then the rights granted to
+You by any and all Contributors for the Covered Software under Section
+2.1 of this License shall terminate.
+
+5.3. In the event of termination under Sections 5.1 or 5.2 above, all
+end user license agreements (excluding distributors and resellers) which
+have been validly granted by You or Your distributors under this License
+prior to termination shall survive termination.
+
+************************************************************************
+*                                                                      *
+*  6. Disclaimer of Warranty                                           *
+*  -------------------------                                           *
+*                                                                      *
+*  Covered Software is provided under this License on an "as is"       *
+*  basis, without warranty of any kind, either expressed, implied, or  *
+*  statutory, including, without limitation, warranties that the       *
+*  Covered Software is free of defects, merchantable, fit for a        *
+*  particular purpose or non-infringing. The entire risk as to the     *
+*  quality and performance of the Covered Software is with You.        *
+*  Should any Covered Software prove defective in any respect, You     *
+*  (not any Contributor) assume the cost of any necessary servicing,   *
+*  repair, or correction. This disclaimer of warranty constitutes an   *
+*  essential part of this License. No use of any Covered Software is   *
+*  authorized under this License except under this disclaimer.         *
+*                                                                      *
+************************************************************************
+
+************************************************************************
+*                                                                      *
+*  7. Limitation of Liability                                          *
+*  --------------------------                                          *
+*                                                                      *
+*  Under no circumstances and under no legal theory, whether tort      *
+*  (including negligence), contract, or otherwise, shall any           *
+*  Contributor, or anyone who distributes Covered Software as          *
+*  permitted above, be liable to You for any direct, indirect,         *
+*  special, incidental, or consequential damages of any character      *
+*  including, without limitation, damages for lost profits, loss of    *
+*  goodwill, work stoppage, computer failure or malfunction, or any    *
+*  and all other commercial damages or losses, even if such party      *
+*  shall have been informed of the possibility of such damages. This   *
+*  limitation of liability shall not apply to liability for death or   *
+*  personal injury resulting from such party's negligence to the       *
+*  extent applicable law prohibits such limitation. Some               *
+*  jurisdictions do not allow the exclusion or limitation of           *
+*  incidental or consequential damages, so this exclusion and          *
+*  limitation may not apply to You.                                    *
+*                                                                      *
+************************************************************************
+
+8. Litigation
+-------------
+
+Any litigation relating to this License may be brought only in the
+courts of a jurisdiction where the defendant maintains its principal
+place of business and such litigation shall be governed by laws of that
+jurisdiction, without reference to its conflict-of-law provisions.
+Nothing in this Section shall prevent a party's ability to bring
+cross-claims or counter-claims.
+
+9. Miscellaneous
+----------------
+
+This License represents the complete agreement concerning the subject
+matter hereof. If any provision of this License is held to be
+unenforceable, such provision shall be reformed only to the extent
+necessary to make it enforceable. Any law or regulation which provides
+that the language of a contract shall be construed against the drafter
+shall not be used to construe this License against a Contributor.
+
+10. Versions of the License
+---------------------------
+
+10.1. New Versions
+
+Mozilla Foundation is the license steward. Except as provided in Section
+10.3, no one other than the license steward has the right to modify or
+publish new versions of this License. Each version will be given a
+distinguishing version number.
+
+10.2. Effect of New Versions
+
+You may distribute the Covered Software under the terms of the version
+of the License under which You originally received the Covered Software,
+or under the terms of any subsequent version published by the license
+steward.
+
+10.3. Modified Versions
+
+If you create software not governed by this License, and you want to
+create a new license for such software, you may create and use a
+modified version of this License if you rename the license and remove
+any references to the name of the license steward (except to note that
+such modified license differs from this License).
+
+10.4. Distributing Source Code Form that is Incompatible With Secondary
+Licenses
+
+If You choose to distribute Source Code Form that is Incompatible With
+Secondary Licenses under the terms of this version of the License, the
+notice described in Exhibit B of this License must be attached.
+
+Exhibit A - Source Code Form License Notice
+-------------------------------------------
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+If it is not possible or desirable to put the notice in a particular
+file, then You may include the notice in a location (such as a LICENSE
+file in a relevant directory) where a recipient would be likely to look
+for such a notice.
+
+You may add additional accurate notices of copyright ownership.
+
+Exhibit B - "Incompatible With Secondary Licenses" Notice
+---------------------------------------------------------
+
+  This Source Code Form is "Incompatible With Secondary Licenses", as
+  defined by the Mozilla Public License, v. 2.0.
+ */
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <new>
+#include <thread>
+#include "EasyDelegateInstrumentationImpl.hpp"
+
+namespace EasyDelegate
+{
+    /**
+     * @brief Report of the single call that exceeded the latency budget
+     * 
+     */
+    struct __DelegateSlowReport
+    {
+        uint32_t key{0};
+        uint64_t timestamp{0};
+        uint64_t duration{0};
+        std::thread::id thread;
+    };
+
+    /**
+     * @brief Policy that reports individual calls exceeding the latency budget into a bounded lock-free ring drained by a monitoring thread.
+     * The fast path is a clock read and a compare, reports are dropped and counted when the ring is full.
+     * Threshold and reports are shared by every container that uses the same tag.
+     * 
+     * @tparam _Tag User defined type that identifies the detector
+     * @tparam _Clock Clock type (__SteadyClock or __CycleClock), thresholds and reports are in its ticks
+     * @tparam _Capacity Count of reports kept until drained, should be power of two
+     * @tparam _KeyCount Count of key indices that can have own threshold
+     */
+    template<class _Tag, class _Clock = __SteadyClock, uint32_t _Capacity = 256, uint32_t _KeyCount = 64>
+    struct __DelegateSlowDetector
+    {
+        static_assert(_Capacity && (_Capacity & (_Capacity - 1)) == 0, "Report ring capacity should be power of two.");
+
+        static constexpr bool enabled = true;
+        using report_t = __DelegateSlowReport;
+
+        /**
+         * @brief Measures the call while alive and reports it if the threshold was exceeded
+         * 
+         */
+        struct scope
+        {
+            explicit scope(uint32_t key) noexcept : m_Key(key), m_Start(_Clock::now()) {}
+
+            ~scope()
+            {
+                const uint64_t end = _Clock::now();
+                if (end - m_Start > _Threshold(m_Key))
+                {
+                    _Report(m_Key, end, end - m_Start);
+                }
+            }
+
+            uint32_t m_Key;
+            uint64_t m_Start;
+        };
+
+        /**
+         * @brief Sets the threshold used by keys without own threshold. Nothing is reported until a threshold is set.
+         * 
+         * @param ticks Latency budget in clock ticks
+         */
+        static inline void threshold(uint64_t ticks) noexcept
+        {
+            s_Threshold.store(ticks, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Sets own threshold of the key, zero makes the key use the common threshold
+         * 
+         * @param key Key index, DelegateKeyIndex for TDelegate
+         * @param ticks Latency budget in clock ticks
+         */
+        static inline void threshold(uint32_t key, uint64_t ticks) noexcept
+        {
+            const uint32_t slot = TakeKeySlot<_KeyCount>(key);
+            if (slot <= _KeyCount)
+            {
+                s_KeyThresholds[slot].store(ticks, std::memory_order_relaxed);
+            }
+        }
+
+        /**
+         * @brief Sets own threshold of the enumerator key
+         * 
+         * @tparam _Enumerator Enumerator class
+         * @param eKey User defined enumeration key
+         * @param ticks Latency budget in clock ticks
+         */
+        template<class _Enumerator, class = std::enable_if_t<std::is_enum<_Enumerator>::value>>
+        static inline void threshold(_Enumerator eKey, uint64_t ticks) noexcept
+        {
+            threshold(TakeKeyIndex(eKey), ticks);
+        }
+
+        /**
+         * @brief Takes the oldest report from the ring
+         * 
+         * @param out Output report
+         * @return true if the report was taken
+         */
+        static inline bool poll(report_t& out) noexcept
+        {
+            uint64_t position = s_Read.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                auto& slot = s_Slots[position & (_Capacity - 1)];
+                const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+                const int64_t difference = static_cast<int64_t>(sequence) - static_cast<int64_t>(position + 1);
+                if (difference < 0)
+                {
+                    return false;
+                }
+                if (difference == 0 && s_Read.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    out = *std::launder(reinterpret_cast<const report_t*>(slot.report));
+                    slot.sequence.store(position + _Capacity, std::memory_order_release);
+                    return true;
+                }
+                if (difference > 0)
+                {
+                    position = s_Read.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        /**
+         * @brief Passes all available reports to the visitor
+         * 
+         * @tparam _Visitor Callable object accepting const report_t&
+         * @param visitor Visitor
+         * @return std::size_t Count of visited reports
+         */
+        template<class _Visitor>
+        static inline std::size_t drain(_Visitor&& visitor)
+        {
+            std::size_t count{0};
+            report_t report;
+            while (poll(report))
+            {
+                visitor(static_cast<const report_t&>(report));
+                ++count;
+            }
+            return count;
+        }
+
+        /**
+         * @brief Returns count of reports dropped because the ring was full
+         * 
+         * @return uint64_t 
+         */
+        [[nodiscard]] static inline uint64_t dropped() noexcept
+        {
+            return s_Dropped.load(std::memory_order_relaxed);
+        }
+
+    private:
+        //Bounded multi-producer queue, the sequence of the slot tells whether it is free for the writer or ready for the reader. 
+        //The report is kept as raw bytes, std::thread::id has no constexpr constructor and would make the ring dynamically initialized.
+        struct __Slot
+        {
+            std::atomic<uint64_t> sequence;
+            alignas(report_t) unsigned char report[sizeof(report_t)];
+        };
+
+        static inline uint64_t _Threshold(uint32_t key) noexcept
+        {
+            const uint32_t slot = TakeKeySlot<_KeyCount>(key);
+            if (slot <= _KeyCount)
+            {
+                const uint64_t ticks = s_KeyThresholds[slot].load(std::memory_order_relaxed);
+                if (ticks)
+                {
+                    return ticks;
+                }
+            }
+            return s_Threshold.load(std::memory_order_relaxed);
+        }
+
+        static void _Report(uint32_t key, uint64_t timestamp, uint64_t duration) noexcept
+        {
+            uint64_t position = s_Write.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                auto& slot = s_Slots[position & (_Capacity - 1)];
+                const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+                const int64_t difference = static_cast<int64_t>(sequence) - static_cast<int64_t>(position);
+                if (difference < 0)
+                {
+                    s_Dropped.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+                if (difference == 0 && s_Write.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                {
+                    new (slot.report) report_t{key, timestamp, duration, std::this_thread::get_id()};
+                    slot.sequence.store(position + 1, std::memory_order_release);
+                    return;
+                }
+                if (difference > 0)
+                {
+                    position = s_Write.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        //Evaluated at compile time, so the ring is ready for handlers timed during static initialization of other translation units
+        static constexpr std::array<__Slot, _Capacity> _MakeSlots() noexcept
+        {
+            return _MakeSlots(std::make_integer_sequence<uint64_t, _Capacity>{});
+        }
+
+        template<uint64_t... _Indices>
+        static constexpr std::array<__Slot, _Capacity> _MakeSlots(std::integer_sequence<uint64_t, _Indices...>) noexcept
+        {
+            return {{__Slot{{_Indices}, {}}...}};
+        }
+
+        EASY_DELEGATE_CONSTINIT static inline std::array<__Slot, _Capacity> s_Slots = _MakeSlots();
+        static inline std::atomic<uint64_t> s_Write{0};
+        static inline std::atomic<uint64_t> s_Read{0};
+        static inline std::atomic<uint64_t> s_Dropped{0};
+        static inline std::atomic<uint64_t> s_Threshold{UINT64_MAX};
+        //The last slot keeps the threshold of TDelegate
+        static inline std::array<std::atomic<uint64_t>, _KeyCount + 1> s_KeyThresholds{};
+    };
+
+    template<class _Tag, class _Clock = __SteadyClock, uint32_t _Capacity = 256, uint32_t _KeyCount = 64>
+    using TDelegateSlowDetector = __DelegateSlowDetector<_Tag, _Clock, _Capacity, _KeyCount>;
+}
+
+/**
+ * @example SlowDetectorExample
+ * 
+ * @code
+#include <iostream>
+#include <thread>
+#include "EasyDelegate.hpp"
+
+using namespace EasyDelegate;
+
+enum class ENetworkDelegate
+{
+    EReceive,
+    ESave
+};
+
+//Tag type that identifies the detector
+struct FNetworkBudget {};
+using detector_t = TDelegateSlowDetector<FNetworkBudget>;
+
+int main()
+{
+    //Thresholds are in clock ticks, nanoseconds for the default clock
+    detector_t::threshold(1'000'000);
+    detector_t::threshold(ENetworkDelegate::ESave, 5'000'000);
+
+    TDelegateMulti<ENetworkDelegate, void(int), __EnumeratorComp<ENetworkDelegate>, detector_t> _handlers;
+    _handlers.attach<ENetworkDelegate::EReceive>([](int packet) 
+    {
+        //Handler blocks once in a while
+        if (packet == 3)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    });
+    _handlers.attach<ENetworkDelegate::ESave>([](int) { std::this_thread::sleep_for(std::chrono::milliseconds(2)); });
+
+    std::thread _worker([&_handlers]() 
+    {
+        for (int packet = 0; packet < 5; ++packet)
+        {
+            _handlers.execute(packet);
+        }
+    });
+    _worker.join();
+
+    //Monitoring thread drains the reports
+    detector_t::drain([](const detector_t::report_t& report)
+    {
+        std::cout << "key " << report.key << " took " << report.duration / 1000 << " us on thread " << report.thread << std::endl;
+    });
+    std::cout << "dropped: " << detector_t::dropped() << std::endl;
+    return 0;
+}
+
+ *   @endcode
+ * 
+ */
\ No newline at end of file
@@ -0,0 +1,477 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#if defined(_MSC_VER)
+#include <malloc.h>
+#endif
+
+/**
+ * @brief Minimal self-contained benchmark harness. Measures time and heap allocations per operation.
+ * Replaces global operator new/delete with counting versions, so include it in exactly one 
+ * translation unit of the benchmark executable.
+ */
+namespace EasyDelegateBenchmark
+{
+    inline std::atomic<uint64_t> g_Allocations{0};
+
+    //MSVC has no std::aligned_alloc, its aligned blocks are released only by _aligned_free
+    inline void* aligned_allocate(std::size_t size, std::size_t align) noexcept
+    {
+#if defined(_MSC_VER)
+        return _aligned_malloc(size ? size : 1, align);
+#else
+        return std::aligned_alloc(align, ((size ? size : 1) + align - 1) / align * align);
+#endif
+    }
+
+    inline void aligned_release(void* ptr) noexcept
+    {
+#if defined(_MSC_VER)
+        _aligned_free(ptr);
+#else
+        std::free(ptr);
+#endif
+    }
+
+    /**
+     * @brief Prevents the compiler from optimizing away the value
+     * 
+     * @tparam _Type 
+     * @param value 
+     */
+    template<class _Type>
+    inline void DoNotOptimize(_Type&& value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const void* sink;
+        sink = &value;
+#endif
+    }
+
+    /**
+     * @brief Forces pending writes to memory
+     * 
+     */
+    inline void ClobberMemory()
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : : "memory");
+#else
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+    }
+
+    /**
+     * @brief Named parameters of the benchmark (key count, call mix...), reported as separate columns
+     * 
+     */
+    using FParams = std::vector<std::pair<std::string, std::string>>;
+
+    /**
+     * @brief Output format of the report
+     * 
+     */
+    enum class EFormat
+    {
+        ETable,
+        ECsv,
+        EJson
+    };
+
+    /**
+     * @brief Result of the single benchmark. For multithreaded benchmarks time is the latency 
+     * of one operation on one thread, allocations are counted over all threads.
+     * 
+     */
+    struct FResult
+    {
+        std::string name;
+        FParams params;
+        unsigned threads;
+        uint64_t iterations;
+        double ns_per_op;
+        double allocs_per_op;
+    };
+
+    /**
+     * @brief Runs benchmarks and stores the results
+     * 
+     */
+    class FRunner
+    {
+    public:
+        /**
+         * @brief Construct a new runner
+         * 
+         * @param filter Only benchmarks with names containing the filter are run
+         * @param minTimeMs Minimal measured time of every repetition
+         * @param repetitions Count of repetitions, the best one is reported
+         */
+        explicit FRunner(std::string filter = {}, double minTimeMs = 50.0, int repetitions = 5) 
+            : m_Filter(std::move(filter)), m_MinTime(minTimeMs * 1e6), m_Repetitions(repetitions) {}
+
+        /**
+         * @brief Calibrates the iteration count, then takes the best of several repetitions
+         * 
+         * @tparam _Function Benchmark body, called once per operation
+         * @param name Benchmark name
+         * @param body Benchmark body
+         * @param params Benchmark parameters
+         */
+        template<class _Function>
+        inline void run(const std::string& name, _Function&& body, FParams params = {})
+        {
+            run_threads(name, 1, body, std::move(params));
+        }
+
+        /**
+         * @brief Same as run, but the body is called concurrently from several threads. 
+         * The iteration count is calibrated on a single thread.
+         * 
+         * @tparam _Function Benchmark body, called once per operation, should be thread safe
+         * @param name Benchmark name
+         * @param threads Count of threads
+         * @param body Benchmark body
+         * @param params Benchmark parameters
+         */
+        template<class _Function>
+        inline void run_threads(const std::string& name, unsigned threads, _Function&& body, FParams params = {})
+        {
+            if (!m_Filter.empty() && name.find(m_Filter) == std::string::npos)
+            {
+                return;
+            }
+
+            uint64_t iterations{1};
+            for (;;)
+            {
+                const double elapsed = measure(body, iterations, 1).first;
+                if (elapsed >= m_MinTime || iterations >= (uint64_t{1} << 40))
+                {
+                    break;
+                }
+                const double scale = elapsed > 0.0 ? std::min(m_MinTime * 1.2 / elapsed, 10.0) : 10.0;
+                iterations = std::max<uint64_t>(iterations + 1, static_cast<uint64_t>(static_cast<double>(iterations) * scale));
+            }
+
+            double best{0.0};
+            uint64_t allocations{0};
+            for (int repetition = 0; repetition < m_Repetitions; ++repetition)
+            {
+                const auto [elapsed, allocated] = measure(body, iterations, threads);
+                if (repetition == 0 || elapsed < best)
+                {
+                    best = elapsed;
+                }
+                allocations = std::max(allocations, allocated);
+            }
+
+            m_Results.push_back(FResult{name, std::move(params), threads, iterations, best / static_cast<double>(iterations),
+                                        static_cast<double>(allocations) / static_cast<double>(iterations * threads)});
+        }
+
+        /**
+         * @brief Prints the results in the requested format
+         * 
+         * @param format Table for reading, csv or json for tooling
+         * @param out Output stream
+         */
+        inline void report(EFormat format = EFormat::ETable, std::FILE* out = stdout) const
+        {
+            switch (format)
+            {
+            case EFormat::ETable: report_table(out); break;
+            case EFormat::ECsv: report_csv(out); break;
+            case EFormat::EJson: report_json(out); break;
+            }
+        }
+
+        /**
+         * @brief Parses "--format=table|csv|json" argument
+         * 
+         * @param arg Command line argument
+         * @param format Parsed format
+         * @return true if the argument was the format option
+         */
+        static inline bool parse_format(const std::string& arg, EFormat& format)
+        {
+            if (arg == "--format=csv") { format = EFormat::ECsv; return true; }
+            if (arg == "--format=json") { format = EFormat::EJson; return true; }
+            if (arg == "--format=table") { format = EFormat::ETable; return true; }
+            return false;
+        }
+
+        inline const std::vector<FResult>& results() const noexcept { return m_Results; }
+
+    private:
+        template<class _Function>
+        inline std::pair<double, uint64_t> measure(_Function& body, uint64_t iterations, unsigned threads)
+        {
+            const uint64_t allocations = g_Allocations.load(std::memory_order_relaxed);
+            if (threads <= 1)
+            {
+                const auto start = std::chrono::steady_clock::now();
+                for (uint64_t i = 0; i < iterations; ++i)
+                {
+                    body();
+                }
+                ClobberMemory();
+                const auto end = std::chrono::steady_clock::now();
+                return {std::chrono::duration<double, std::nano>(end - start).count(), g_Allocations.load(std::memory_order_relaxed) - allocations};
+            }
+
+            std::atomic<unsigned> ready{0};
+            std::atomic<bool> go{false};
+            std::vector<std::thread> workers;
+            workers.reserve(threads);
+            for (unsigned t = 0; t < threads; ++t)
+            {
+                workers.emplace_back([&]
+                {
+                    ready.fetch_add(1);
+                    while (!go.load(std::memory_order_acquire))
+                    {
+                        std::this_thread::yield();
+                    }
+                    for (uint64_t i = 0; i < iterations; ++i)
+                    {
+                        body();
+                    }
+                    ClobberMemory();
+                });
+            }
+            while (ready.load() != threads)
+            {
+                std::this_thread::yield();
+            }
+
+            const uint64_t started = g_Allocations.load(std::memory_order_relaxed);
+            const auto start = std::chrono::steady_clock::now();
+            go.store(true, std::memory_order_release);
+            for (auto& worker : workers)
+            {
+                worker.join();
+            }
+            const auto end = std::chrono::steady_clock::now();
+            return {std::chrono::duration<double, std::nano>(end - start).count(), g_Allocations.load(std::memory_order_relaxed) - started};
+        }
+
+        inline std::vector<std::string> param_names() const
+        {
+            std::vector<std::string> names;
+            for (auto& result : m_Results)
+            {
+                for (auto& [key, value] : result.params)
+                {
+                    if (std::find(names.begin(), names.end(), key) == names.end())
+                    {
+                        names.push_back(key);
+                    }
+                }
+            }
+            return names;
+        }
+
+        static inline const std::string* find_param(const FResult& result, const std::string& name)
+        {
+            for (auto& [key, value] : result.params)
+            {
+                if (key == name)
+                {
+                    return &value;
+                }
+            }
+            return nullptr;
+        }
+
+        inline void report_table(std::FILE* out) const
+        {
+            std::fprintf(out, "%-56s %8s %14s %12s %14s\n", "Benchmark", "Threads", "Iterations", "ns/op", "allocs/op");
+            for (auto& result : m_Results)
+            {
+                std::fprintf(out, "%-56s %8u %14llu %12.2f %14.3f\n", result.name.c_str(), result.threads,
+                             static_cast<unsigned long long>(result.iterations), result.ns_per_op, result.allocs_per_op);
+            }
+        }
+
+        inline void report_csv(std::FILE* out) const
+        {
+            const auto names = param_names();
+            std::fprintf(out, "name");
+            for (auto& name : names)
+            {
+                std::fprintf(out, ",%s", name.c_str());
+            }
+            std::fprintf(out, ",threads,iterations,ns_per_op,allocs_per_op\n");
+            for (auto& result : m_Results)
+            {
+                std::fprintf(out, "\"%s\"", result.name.c_str());
+                for (auto& name : names)
+                {
+                    const std::string* value = find_param(result, name);
+                    std::fprintf(out, ",%s", value ? value->c_str() : "");
+                }
+                std::fprintf(out, ",%u,%llu,%.3f,%.4f\n", result.threads, static_cast<unsigned long long>(result.iterations),
+                             result.ns_per_op, result.allocs_per_op);
+            }
+        }
+
+        inline void report_json(std::FILE* out) const
+        {
+            std::fprintf(out, "[\n");
+            for (std::size_t i = 0; i < m_Results.size(); ++i)
+            {
+                auto& result = m_Results[i];
+                std::fprintf(out, "  {\"name\": \"%s\"", result.name.c_str());
+                for (auto& [key, value] : result.params)
+                {
+                    std::fprintf(out, ", \"%s\": \"%s\"", key.c_str(), value.c_str());
+                }
+                std::fprintf(out, ", \"threads\": %u, \"iterations\": %llu, \"ns_per_op\": %.3f, \"allocs_per_op\": %.4f}%s\n",
+                             result.threads, static_cast<unsigned long long>(result.iterations), result.ns_per_op, result.allocs_per_op,
+                             i + 1 < m_Results.size() ? "," : "");
+            }
+            std::fprintf(out, "]\n");
+        }
+
+        std::string m_Filter;
+        double m_MinTime;
+        int m_Repetitions;
+        std::vector<FResult> m_Results;
+    };
+}
+
+//Replacement of every global allocation function, so each allocation is counted and every pointer is released 
+//by the function matching its allocation. GCC still pairs the inlined std::free with the replaced operator new 
+//and reports -Wmismatched-new-delete for the library containers, the pairs below match by construction.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void* operator new(std::size_t size)
+{
+    EasyDelegateBenchmark::g_Allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    EasyDelegateBenchmark::g_Allocations.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size ? size : 1);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept
+{
+    return operator new(size, tag);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    EasyDelegateBenchmark::g_Allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = EasyDelegateBenchmark::aligned_allocate(size, static_cast<std::size_t>(alignment)))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return operator new(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    EasyDelegateBenchmark::g_Allocations.fetch_add(1, std::memory_order_relaxed);
+    return EasyDelegateBenchmark::aligned_allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t& tag) noexcept
+{
+    return operator new(size, alignment, tag);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+    EasyDelegateBenchmark::aligned_release(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept
+{
+    EasyDelegateBenchmark::aligned_release(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    EasyDelegateBenchmark::aligned_release(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    EasyDelegateBenchmark::aligned_release(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    EasyDelegateBenchmark::aligned_release(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    EasyDelegateBenchmark::aligned_release(ptr);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
@@ -0,0 +1,600 @@
+#include <array>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "EasyDelegate.hpp"
+#include "BenchmarkHarness.hpp"
+
+using namespace EasyDelegate;
+using namespace EasyDelegateBenchmark;
+
+// Build with optimizations (-DCMAKE_BUILD_TYPE=Release).
+// Usage: DELEGATE_BENCHMARK [--format=table|csv|json] [filter]
+
+enum class EMultiKey
+{
+    EFirst,
+    ESecond,
+    EThird,
+    EFourth
+};
+
+enum class EAnyKey
+{
+    EInt,
+    EVoid
+};
+
+enum class ECompileTimeKey
+{
+    EInt,
+    EBound,
+    ELambda,
+    EVoid
+};
+
+//Large argument passed by value
+struct FLargeArgument
+{
+    std::array<int, 64> data;
+};
+
+//Tags of the instrumented delegates
+struct FSteadyStats {};
+struct FCycleStats {};
+
+//Capture of the configurable size
+template<std::size_t _Size>
+struct FCapture
+{
+    std::array<char, _Size> data{};
+};
+
+int add(int x, int y)
+{
+    return x + y;
+}
+
+void sink(int x, int y)
+{
+    DoNotOptimize(x);
+    DoNotOptimize(y);
+}
+
+int sum_large(FLargeArgument arg)
+{
+    return arg.data[0] + arg.data[63];
+}
+
+std::size_t string_length(const std::string& str)
+{
+    return str.size();
+}
+
+DeclareDelegateFuncRuntime(EAnyKey, EAnyKey::EInt, int(int, int))
+DeclareDelegateFuncRuntime(EAnyKey, EAnyKey::EVoid, void(int, int))
+
+DeclareDelegateFuncCompileTime(ECompileTimeKey, ECompileTimeKey::EInt, int(int, int))
+DeclareDelegateFuncCompileTimeBound(ECompileTimeKey, ECompileTimeKey::EBound, int(int, int), &add)
+DeclareDelegateFuncCompileTime(ECompileTimeKey, ECompileTimeKey::ELambda, int(int, int))
+DeclareDelegateFuncCompileTime(ECompileTimeKey, ECompileTimeKey::EVoid, void(int, int))
+
+class FAdder
+{
+public:
+    int add(int x, int y)
+    {
+        return x + y + m_Bias;
+    }
+
+private:
+    int m_Bias{0};
+};
+
+struct IInterface
+{
+    virtual ~IInterface() = default;
+    virtual int call(int x, int y) = 0;
+};
+
+struct FImplementation : IInterface
+{
+    int call(int x, int y) override
+    {
+        return x + y;
+    }
+};
+
+template<std::size_t _Size>
+void bench_capture(FRunner& runner)
+{
+    const std::string suffix = "<" + std::to_string(_Size) + ">";
+    FCapture<_Size> capture;
+    auto lambda = [capture](int x, int y) { return x + y + capture.data[0]; };
+
+    runner.run("bind/TDelegate/lambda" + suffix, [&]
+    {
+        TDelegate<int(int, int)> _delegate;
+        _delegate.attach(lambda);
+        DoNotOptimize(_delegate);
+    });
+
+    TDelegate<int(int, int)> source(lambda);
+    runner.run("copy/TDelegate/lambda" + suffix, [&]
+    {
+        TDelegate<int(int, int)> copy(source);
+        DoNotOptimize(copy);
+    });
+
+    int x{1}, y{2};
+    runner.run("call/TDelegate/lambda" + suffix, [&]
+    {
+        DoNotOptimize(source(x, y));
+    });
+
+    TDelegateAny<EAnyKey> any;
+    any.attach<EAnyKey::EInt>(lambda);
+    runner.run("call/TDelegateAny::eval/lambda" + suffix, [&]
+    {
+        DoNotOptimize(any.eval<EAnyKey::EInt>(x, y));
+    });
+
+    TDelegateAnyCT<ECompileTimeKey>::attach<ECompileTimeKey::ELambda>(lambda);
+    runner.run("call/TDelegateAnyCT::eval/lambda" + suffix, [&]
+    {
+        DoNotOptimize(TDelegateAnyCT<ECompileTimeKey>::eval<ECompileTimeKey::ELambda>(x, y));
+    });
+    TDelegateAnyCT<ECompileTimeKey>::detach<ECompileTimeKey::ELambda>();
+}
+
+void bench_baseline(FRunner& runner)
+{
+    int x{1}, y{2};
+
+    int (*function)(int, int) = &add;
+    runner.run("call/baseline/function pointer", [&]
+    {
+        DoNotOptimize(function);
+        DoNotOptimize(function(x, y));
+    });
+
+    std::unique_ptr<IInterface> object = std::make_unique<FImplementation>();
+    runner.run("call/baseline/virtual", [&]
+    {
+        IInterface* ptr = object.get();
+        DoNotOptimize(ptr);
+        DoNotOptimize(ptr->call(x, y));
+    });
+
+    std::function<int(int, int)> stdfunction(&add);
+    runner.run("call/baseline/std::function", [&]
+    {
+        DoNotOptimize(stdfunction(x, y));
+    });
+}
+
+void bench_delegate(FRunner& runner)
+{
+    int x{1}, y{2};
+    FAdder adder;
+
+    runner.run("bind/TDelegate/function", [&]
+    {
+        TDelegate<int(int, int)> _delegate;
+        _delegate.attach(&add);
+        DoNotOptimize(_delegate);
+    });
+
+    runner.run("bind/TDelegate/method", [&]
+    {
+        TDelegate<int(int, int)> _delegate;
+        _delegate.attach(&adder, &FAdder::add);
+        DoNotOptimize(_delegate);
+    });
+
+    runner.run("bind/TDelegate/static method", [&]
+    {
+        TDelegate<int(int, int)> _delegate;
+        _delegate.attach<&FAdder::add>(&adder);
+        DoNotOptimize(_delegate);
+    });
+
+    runner.run("bind/TDelegate/bind_front<method>(object, value)", [&]
+    {
+        TDelegate<int(int)> _delegate(bind_front<&FAdder::add>(&adder, x));
+        DoNotOptimize(_delegate);
+    });
+
+    runner.run("bind/TDelegate/std::bind(method, object, value)", [&]
+    {
+        TDelegate<int(int)> _delegate(std::bind(&FAdder::add, &adder, x, std::placeholders::_1));
+        DoNotOptimize(_delegate);
+    });
+
+    TDelegate<int(int, int)> function(&add);
+    runner.run("call/TDelegate/function", [&]
+    {
+        DoNotOptimize(function(x, y));
+    });
+
+    TDelegate<int(int, int)> method(&adder, &FAdder::add);
+    runner.run("call/TDelegate/method", [&]
+    {
+        DoNotOptimize(method(x, y));
+    });
+
+    TDelegate<int(int, int)> staticMethod;
+    staticMethod.attach<&FAdder::add>(&adder);
+    runner.run("call/TDelegate/static method", [&]
+    {
+        DoNotOptimize(staticMethod(x, y));
+    });
+
+    TDelegate<int(int, int), TDelegateInstrumentation<FSteadyStats>> steady(&add);
+    runner.run("call/TDelegate/function instrumented steady clock", [&]
+    {
+        DoNotOptimize(steady(x, y));
+    });
+
+    TDelegate<int(int, int), TDelegateInstrumentation<FCycleStats, __CycleClock>> cycle(&add);
+    runner.run("call/TDelegate/function instrumented cycle clock", [&]
+    {
+        DoNotOptimize(cycle(x, y));
+    });
+
+    runner.run("copy/TDelegate/method", [&]
+    {
+        TDelegate<int(int, int)> copy(method);
+        DoNotOptimize(copy);
+    });
+
+    FLargeArgument large{};
+    TDelegate<int(FLargeArgument)> largeDelegate(&sum_large);
+    runner.run("call/TDelegate/large argument by value", [&]
+    {
+        DoNotOptimize(largeDelegate(large));
+    });
+
+    const std::string str(64, 'x');
+    TDelegate<std::size_t(const std::string&)> stringDelegate(&string_length);
+    runner.run("call/TDelegate/const std::string&", [&]
+    {
+        DoNotOptimize(stringDelegate(str));
+    });
+}
+
+void bench_multi(FRunner& runner)
+{
+    int x{1}, y{2};
+
+    TDelegateMulti<EMultiKey, void(int, int)> multi;
+    multi.attach<EMultiKey::EFirst>(&sink);
+    multi.attach<EMultiKey::ESecond>(&sink);
+    multi.attach<EMultiKey::EThird>(&sink);
+    multi.attach<EMultiKey::EFourth>(&sink);
+
+    runner.run("call/TDelegateMulti::execute<key>", [&]
+    {
+        multi.execute<EMultiKey::EThird>(x, y);
+    });
+
+    runner.run("call/TDelegateMulti::execute all<4>", [&]
+    {
+        multi.execute(x, y);
+    });
+
+    TDelegateMulti<EMultiKey, void(int, int)> muted(multi);
+    muted.disable(TDelegateKeyMask<EMultiKey>{EMultiKey::EFirst, EMultiKey::EThird});
+    runner.run("call/TDelegateMulti::execute all<4>/2 muted", [&]
+    {
+        muted.execute(x, y);
+    });
+
+    const auto& category = key_mask<EMultiKey::ESecond, EMultiKey::EFourth>();
+    runner.run("call/TDelegateMulti::execute(category<2>)", [&]
+    {
+        multi.execute(category, x, y);
+    });
+
+    runner.run("call/TDelegateMulti::execute<key> x2", [&]
+    {
+        multi.execute<EMultiKey::ESecond>(x, y);
+        multi.execute<EMultiKey::EFourth>(x, y);
+    });
+
+    runner.run("call/TDelegateMulti::disable+enable", [&]
+    {
+        muted.disable<EMultiKey::ESecond>();
+        muted.enable<EMultiKey::ESecond>();
+    });
+
+    TDelegateMulti<EMultiKey, int(int, int)> multiEval;
+    multiEval.attach<EMultiKey::EFirst>(&add);
+    multiEval.attach<EMultiKey::ESecond>(&add);
+    multiEval.attach<EMultiKey::EThird>(&add);
+    multiEval.attach<EMultiKey::EFourth>(&add);
+
+    runner.run("call/TDelegateMulti::eval<key>", [&]
+    {
+        DoNotOptimize(multiEval.eval<EMultiKey::EThird>(x, y));
+    });
+
+    runner.run("call/TDelegateMulti::eval all<4>", [&]
+    {
+        auto results = multiEval.eval(x, y);
+        DoNotOptimize(results);
+    });
+
+    const auto frozen = multi.freeze();
+    runner.run("call/TFrozenDelegateMulti::execute<key>", [&]
+    {
+        frozen.execute<EMultiKey::EThird>(x, y);
+    });
+
+    runner.run("call/TFrozenDelegateMulti::execute all<4>", [&]
+    {
+        frozen.execute(x, y);
+    });
+
+    const auto frozenEval = multiEval.freeze();
+    runner.run("call/TFrozenDelegateMulti::eval<key>", [&]
+    {
+        DoNotOptimize(frozenEval.eval<EMultiKey::EThird>(x, y));
+    });
+
+    runner.run("bind/TDelegateMulti/function", [&]
+    {
+        TDelegateMulti<EMultiKey, int(int, int)> container;
+        container.attach<EMultiKey::EFirst>(&add);
+        DoNotOptimize(container);
+    });
+}
+
+void bench_multi_ct(FRunner& runner)
+{
+    int x{1}, y{2};
+
+    using multi_ct_t = TDelegateMultiCT<EMultiKey, void(int, int), 
+        TDelegateSlot<EMultiKey::EFirst, &sink>, TDelegateSlot<EMultiKey::ESecond, &sink>, 
+        TDelegateSlot<EMultiKey::EThird, &sink>, TDelegateSlot<EMultiKey::EFourth, &sink>>;
+
+    runner.run("call/TDelegateMultiCT::execute<key>", [&]
+    {
+        multi_ct_t::execute<EMultiKey::EThird>(x, y);
+    });
+
+    runner.run("call/TDelegateMultiCT::execute all<4>", [&]
+    {
+        multi_ct_t::execute(x, y);
+    });
+
+    using multi_ct_eval_t = TDelegateMultiCT<EMultiKey, int(int, int), 
+        TDelegateSlot<EMultiKey::EFirst, &add>, TDelegateSlot<EMultiKey::ESecond, &add>, 
+        TDelegateSlot<EMultiKey::EThird, &add>, TDelegateSlot<EMultiKey::EFourth, &add>>;
+
+    runner.run("call/TDelegateMultiCT::eval all<4>", [&]
+    {
+        auto results = multi_ct_eval_t::eval(x, y);
+        DoNotOptimize(results);
+    });
+}
+
+void bench_any(FRunner& runner)
+{
+    int x{1}, y{2};
+
+    TDelegateAny<EAnyKey> any;
+    any.attach<EAnyKey::EInt>(&add);
+    any.attach<EAnyKey::EVoid>(&sink);
+
+    runner.run("call/TDelegateAny::eval/function", [&]
+    {
+        DoNotOptimize(any.eval<EAnyKey::EInt>(x, y));
+    });
+
+    runner.run("call/TDelegateAny::execute/function", [&]
+    {
+        any.execute<EAnyKey::EVoid>(x, y);
+    });
+
+    runner.run("bind/TDelegateAny/function", [&]
+    {
+        TDelegateAny<EAnyKey> container;
+        container.attach<EAnyKey::EInt>(&add);
+        DoNotOptimize(container);
+    });
+}
+
+void bench_any_ct(FRunner& runner)
+{
+    int x{1}, y{2};
+    using any_ct_t = TDelegateAnyCT<ECompileTimeKey>;
+
+    any_ct_t::attach<ECompileTimeKey::EInt>(&add);
+    runner.run("call/TDelegateAnyCT::eval/function", [&]
+    {
+        DoNotOptimize(any_ct_t::eval<ECompileTimeKey::EInt>(x, y));
+    });
+
+    runner.run("call/TDelegateAnyCT::eval/compile-time bound", [&]
+    {
+        DoNotOptimize(any_ct_t::eval<ECompileTimeKey::EBound>(x, y));
+    });
+
+    any_ct_t::attach<ECompileTimeKey::EVoid, &sink>();
+    runner.run("call/TDelegateAnyCT::execute<key>", [&]
+    {
+        any_ct_t::execute<ECompileTimeKey::EVoid>(x, y);
+    });
+
+    ECompileTimeKey eRuntimeKey{ECompileTimeKey::EVoid};
+    runner.run("call/TDelegateAnyCT::execute(runtime key)", [&]
+    {
+        DoNotOptimize(eRuntimeKey);
+        DoNotOptimize(any_ct_t::execute(eRuntimeKey, x, y));
+    });
+
+    runner.run("bind/TDelegateAnyCT/static function", [&]
+    {
+        any_ct_t::attach<ECompileTimeKey::EInt, &add>();
+    });
+
+    runner.run("bind/TDelegateAnyCT/function", [&]
+    {
+        any_ct_t::attach<ECompileTimeKey::EInt>(&add);
+    });
+}
+
+void bench_async(FRunner& runner)
+{
+    int x{1}, y{2};
+    TDelegate<int(int, int)> function(&add);
+
+    runner.run("async/TDelegate::invoke_async", [&]
+    {
+        DoNotOptimize(function.invoke_async(x, y).get());
+    });
+
+    runner.run("async/baseline/std::async", [&]
+    {
+        DoNotOptimize(std::async(std::launch::async, std::ref(function), x, y).get());
+    });
+}
+
+void bench_batch(FRunner& runner)
+{
+    constexpr std::size_t count = 4096;
+    std::vector<int> xs(count, 1), ys(count, 2), results(count);
+    std::vector<std::tuple<int, int>> rows(count, std::tuple<int, int>{1, 2});
+    TDelegate<int(int, int)> plain([](int x, int y) { return x + y; });
+    TTypedDelegate<int(int, int)> function(&add);
+    TTypedDelegate<int(int, int)> lambda([](int x, int y) { return x + y; });
+
+    runner.run("batch/TDelegate::operator() loop<4096>", [&]
+    {
+        for (std::size_t index = 0; index < count; ++index)
+        {
+            results[index] = plain(xs[index], ys[index]);
+        }
+        DoNotOptimize(results.data());
+    });
+
+    runner.run("batch/TTypedDelegate::invoke_batch<4096>", [&]
+    {
+        lambda.invoke_batch(rows.data(), count, results.data());
+        DoNotOptimize(results.data());
+    });
+
+    runner.run("batch/TTypedDelegate::invoke_batch_soa<4096>", [&]
+    {
+        lambda.invoke_batch_soa(count, results.data(), xs.data(), ys.data());
+        DoNotOptimize(results.data());
+    });
+
+    runner.run("batch/TTypedDelegate::invoke_batch_soa<4096>/function", [&]
+    {
+        function.invoke_batch_soa(count, results.data(), xs.data(), ys.data());
+        DoNotOptimize(results.data());
+    });
+}
+
+int twice(int x)
+{
+    return x * 2;
+}
+
+int increment(int x)
+{
+    return x + 1;
+}
+
+void bench_compose(FRunner& runner)
+{
+    int x{1};
+    TDelegate<int(int)> first(&twice), second(&increment), third(&twice);
+    runner.run("compose/nested TDelegate<3>", [&]
+    {
+        DoNotOptimize(third(second(first(x))));
+    });
+
+    TDelegate<int(int)> fused(pipe(stage<&twice>(), stage<&increment>(), stage<&twice>()));
+    runner.run("compose/TDelegate pipe<3>", [&]
+    {
+        DoNotOptimize(fused(x));
+    });
+}
+
+int subtract(int x, int y)
+{
+    return x - y;
+}
+
+void bench_inline_cache(FRunner& runner)
+{
+    int x{1}, y{2};
+    TDelegate<int(int, int)> function(&add);
+    runner.run("inline cache/TDelegate::operator()", [&]
+    {
+        DoNotOptimize(function(x, y));
+    });
+
+    runner.run("inline cache/TDelegate::invoke_expect/monomorphic", [&]
+    {
+        DoNotOptimize(function.invoke_expect<&add>(x, y));
+    });
+
+    TTypedDelegate<int(int, int)> typed(&add);
+    runner.run("inline cache/TTypedDelegate::invoke_expect/monomorphic", [&]
+    {
+        DoNotOptimize(typed.invoke_expect<&add>(x, y));
+    });
+
+    //Every other call misses the cache and falls back to the delegate
+    TTypedDelegate<int(int, int)> sites[2]{TTypedDelegate<int(int, int)>(&add), TTypedDelegate<int(int, int)>(&subtract)};
+    std::size_t index{0};
+    runner.run("inline cache/TTypedDelegate::operator()/polymorphic", [&]
+    {
+        DoNotOptimize(sites[index++ & 1](x, y));
+    });
+
+    runner.run("inline cache/TTypedDelegate::invoke_expect/polymorphic", [&]
+    {
+        DoNotOptimize(sites[index++ & 1].invoke_expect<&add>(x, y));
+    });
+}
+
+int main(int argc, char** argv)
+{
+    EFormat format{EFormat::ETable};
+    std::string filter;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!FRunner::parse_format(argv[i], format))
+        {
+            filter = argv[i];
+        }
+    }
+    FRunner runner(filter);
+
+    bench_baseline(runner);
+    bench_delegate(runner);
+    bench_capture<8>(runner);
+    bench_capture<16>(runner);
+    bench_capture<32>(runner);
+    bench_capture<128>(runner);
+    bench_multi(runner);
+    bench_multi_ct(runner);
+    bench_any(runner);
+    bench_any_ct(runner);
+    bench_async(runner);
+    bench_batch(runner);
+    bench_compose(runner);
+    bench_inline_cache(runner);
+
+    runner.report(format);
+
+    return 0;
+}
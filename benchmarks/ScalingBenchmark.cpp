@@ -0,0 +1,134 @@
+#include <array>
+#include <string>
+#include <utility>
+#include "EasyDelegate.hpp"
+#include "BenchmarkHarness.hpp"
+
+using namespace EasyDelegate;
+using namespace EasyDelegateBenchmark;
+
+// Sweeps key count, call mix and reader thread count for TDelegateMulti and TDelegateAny.
+// Build with optimizations (-DCMAKE_BUILD_TYPE=Release).
+// Usage: SCALING_BENCHMARK [--format=table|csv|json] [filter]
+
+//Keys are generated, there is no need to name them
+enum class EScaleKey : uint32_t
+{
+};
+
+//Every key of the enumerator has the same signature, declaring them one by one is not required
+template<EScaleKey eBase>
+struct EasyDelegate::__DelegateTypeStore<eBase>
+{
+    using type = EasyDelegate::__Delegate<int(int, int)>;
+    using signature = int(int, int);
+};
+
+int add(int x, int y)
+{
+    return x + y;
+}
+
+void sink(int x, int y)
+{
+    DoNotOptimize(x);
+    DoNotOptimize(y);
+}
+
+//Largest key count of the sweep
+constexpr std::size_t g_MaxKeyCount = 4096;
+
+template<class _Container, class _Function, std::size_t _Index>
+void attach_key(_Container& container, _Function function)
+{
+    container.template attach<static_cast<EScaleKey>(_Index)>(function);
+}
+
+template<class _Container, class _Function, std::size_t ...Indices>
+constexpr auto make_attachers(std::index_sequence<Indices...>)
+{
+    return std::array<void (*)(_Container&, _Function), sizeof...(Indices)>{&attach_key<_Container, _Function, Indices>...};
+}
+
+//Attaching through one table of small functions shared by every key count keeps compile time low for thousands of keys
+template<class _Container, class _Function>
+void fill(_Container& container, _Function function, std::size_t count)
+{
+    static constexpr auto attachers = make_attachers<_Container, _Function>(std::make_index_sequence<g_MaxKeyCount>{});
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        attachers[i](container, function);
+    }
+}
+
+template<std::size_t _KeyCount>
+void bench_keys(FRunner& runner, const std::vector<unsigned>& threads)
+{
+    constexpr EScaleKey eMiddle = static_cast<EScaleKey>(_KeyCount / 2);
+    const std::string keys = std::to_string(_KeyCount);
+
+    TDelegateMulti<EScaleKey, void(int, int)> multiExecute;
+    fill(multiExecute, &sink, _KeyCount);
+
+    TDelegateMulti<EScaleKey, int(int, int)> multiEval;
+    fill(multiEval, &add, _KeyCount);
+
+    TDelegateAny<EScaleKey> any;
+    fill(any, &add, _KeyCount);
+
+    for (unsigned count : threads)
+    {
+        const std::string suffix = "/keys:" + keys + "/threads:" + std::to_string(count);
+
+        runner.run_threads("TDelegateMulti/execute<key>" + suffix, count, [&]
+        {
+            multiExecute.template execute<eMiddle>(1, 2);
+        }, {{"container", "TDelegateMulti"}, {"mix", "single-key"}, {"keys", keys}});
+
+        runner.run_threads("TDelegateMulti/eval<key>" + suffix, count, [&]
+        {
+            DoNotOptimize(multiEval.template eval<eMiddle>(1, 2));
+        }, {{"container", "TDelegateMulti"}, {"mix", "single-key-eval"}, {"keys", keys}});
+
+        runner.run_threads("TDelegateMulti/execute all" + suffix, count, [&]
+        {
+            multiExecute.execute(1, 2);
+        }, {{"container", "TDelegateMulti"}, {"mix", "execute-all"}, {"keys", keys}});
+
+        runner.run_threads("TDelegateMulti/eval all" + suffix, count, [&]
+        {
+            auto results = multiEval.eval(1, 2);
+            DoNotOptimize(results);
+        }, {{"container", "TDelegateMulti"}, {"mix", "eval-all"}, {"keys", keys}});
+
+        runner.run_threads("TDelegateAny/eval<key>" + suffix, count, [&]
+        {
+            DoNotOptimize(any.template eval<eMiddle>(1, 2));
+        }, {{"container", "TDelegateAny"}, {"mix", "single-key-eval"}, {"keys", keys}});
+    }
+}
+
+int main(int argc, char** argv)
+{
+    EFormat format{EFormat::ETable};
+    std::string filter;
+    for (int i = 1; i < argc; ++i)
+    {
+        if (!FRunner::parse_format(argv[i], format))
+        {
+            filter = argv[i];
+        }
+    }
+
+    FRunner runner(filter, 20.0, 3);
+    const std::vector<unsigned> threads{1, 2, 4, 8};
+
+    bench_keys<4>(runner, threads);
+    bench_keys<64>(runner, threads);
+    bench_keys<512>(runner, threads);
+    bench_keys<4096>(runner, threads);
+
+    runner.report(format);
+
+    return 0;
+}
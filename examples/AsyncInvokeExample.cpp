@@ -0,0 +1,47 @@
+#include <iostream>
+#include <string>
+#include "EasyDelegate.hpp"
+
+using namespace EasyDelegate;
+
+enum class EJobDelegate
+{
+    ECompress,
+    EHash
+};
+
+int compress(const std::string& data, int level)
+{
+    return static_cast<int>(data.size()) / level;
+}
+
+int hash(const std::string& data, int seed)
+{
+    unsigned result = static_cast<unsigned>(seed);
+    for (char c : data)
+    {
+        result = result * 31u + static_cast<unsigned>(c);
+    }
+    return static_cast<int>(result & 0xFFFF);
+}
+
+int main()
+{
+    TDelegate<int(const std::string&, int)> _compress(&compress);
+
+    //Call is submitted to the library thread pool, arguments are copied into the future
+    auto _future = _compress.invoke_async(std::string("some large buffer"), 2);
+
+    //Keyed calls
+    TDelegateMulti<EJobDelegate, int(const std::string&, int)> _jobs;
+    _jobs.attach<EJobDelegate::ECompress>(&compress);
+    _jobs.attach<EJobDelegate::EHash>(&hash);
+    auto _hash = _jobs.invoke_async<EJobDelegate::EHash>(std::string("payload"), 7);
+
+    //Explicit pool, the future waits for the call on destruction
+    TDelegateThreadPool _pool(2);
+    auto _local = _pool.submit(std::ref(_compress), std::string("another buffer"), 4);
+
+    std::cout << "compressed: " << _future.get() << ", hash: " << _hash.get() << ", local: " << _local.get() << std::endl;
+    return 0;
+}
@@ -0,0 +1,52 @@
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "EasyDelegate.hpp"
+
+using namespace EasyDelegate;
+
+float scale(float value, float factor)
+{
+    return value * factor;
+}
+
+class FCounter
+{
+public:
+    void count(const std::string& word)
+    {
+        letters += word.size();
+    }
+
+    std::size_t letters{0};
+};
+
+int main()
+{
+    TTypedDelegate<float(float, float)> _scale(&scale);
+
+    //Structure of arrays, one array per argument
+    std::vector<float> _values(10000, 2.f), _factors(10000, 0.5f), _results(10000);
+    _scale.invoke_batch_soa(_values.size(), _results.data(), _values.data(), _factors.data());
+
+    //Array of argument tuples
+    std::vector<std::tuple<float, float>> _rows{{1.f, 2.f}, {3.f, 4.f}, {5.f, 6.f}};
+    std::vector<float> _rowResults(_rows.size());
+    _scale.invoke_batch(_rows.data(), _rows.size(), _rowResults.data());
+
+    //Lambdas are inlined into the loop as well
+    TTypedDelegate<int(int)> _square([](int x) { return x * x; });
+    std::vector<std::tuple<int>> _numbers{{1}, {2}, {3}, {4}};
+    std::vector<int> _squares(_numbers.size());
+    _square.invoke_batch(_numbers.data(), _numbers.size(), _squares.data());
+
+    //Delegates without result
+    FCounter _counter;
+    TTypedDelegate<void(const std::string&)> _count(&_counter, &FCounter::count);
+    std::vector<std::tuple<std::string>> _words{{"batch"}, {"of"}, {"words"}};
+    _count.invoke_batch(_words.data(), _words.size());
+
+    std::cout << "scaled: " << _results.front() << ", rows: " << _rowResults.back() << ", squares: " << _squares.back() << ", letters: " << _counter.letters << std::endl;
+    return 0;
+}
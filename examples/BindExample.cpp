@@ -0,0 +1,70 @@
+#include <iostream>
+#include <string>
+#include "EasyDelegate.hpp"
+
+using namespace EasyDelegate;
+
+enum class EInput
+{
+    EKey,
+    EAxis
+};
+
+DeclareDelegateFuncRuntime(EInput, EInput::EKey, void(int))
+DeclareDelegateFuncRuntime(EInput, EInput::EAxis, void(float, int))
+
+void print_axis(int player, float value)
+{
+    std::cout << "player " << player << " axis: " << value << std::endl;
+}
+
+std::string join(const std::string& first, const std::string& second, const std::string& separator)
+{
+    return first + separator + second;
+}
+
+class FPlayer
+{
+public:
+    void key(int code)
+    {
+        std::cout << "player key: " << code << std::endl;
+    }
+
+    int damage(int base, int multiplier)
+    {
+        return base * multiplier + m_Bonus;
+    }
+
+private:
+    int m_Bonus{5};
+};
+
+int main()
+{
+    FPlayer _player;
+
+    //Method and object bound without allocation, the delegate keeps only the object pointer
+    TDelegate<void(int)> _key;
+    _key.attach<&FPlayer::key>(&_player);
+    _key(32);
+
+    //Object pointer and first argument bound to the method
+    TDelegate<int(int)> _damage(bind_front<&FPlayer::damage>(&_player, 10));
+    std::cout << "damage: " << _damage(3) << std::endl;
+
+    //Last argument bound
+    TDelegate<std::string(const std::string&, const std::string&)> _path(bind_back(&join, "/"));
+    std::cout << _path("assets", "textures") << std::endl;
+
+    //Arguments swapped instead of std::bind(&print_axis, std::placeholders::_2, std::placeholders::_1)
+    TDelegateMulti<EInput, void(float, int)> _multi;
+    _multi.attach<EInput::EAxis>(reorder<1, 0>(stage<&print_axis>()));
+    _multi.execute<EInput::EAxis>(0.5f, 1);
+
+    //Reordering and binding can be combined, the value argument is dropped here
+    TDelegateAny<EInput> _any;
+    _any.attach<EInput::EKey>(reorder<>(bind_front<&FPlayer::key>(&_player, 13)));
+    _any.execute<EInput::EKey>(0);
+    return 0;
+}
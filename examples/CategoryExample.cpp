@@ -0,0 +1,46 @@
+#include <iostream>
+#include "EasyDelegate.hpp"
+
+using namespace EasyDelegate;
+
+enum class ESubsystem
+{
+    ESocket,
+    EReplication,
+    EMixer,
+    EMusic,
+    ERenderer
+};
+
+//Categories are declared once and shared by all the containers
+const auto& g_Network = key_mask<ESubsystem::ESocket, ESubsystem::EReplication>();
+const auto& g_Audio = key_mask<ESubsystem::EMixer, ESubsystem::EMusic>();
+
+int main()
+{
+    TDelegateMulti<ESubsystem, void(float)> _update;
+    _update.attach<ESubsystem::ESocket>([](float delta) { std::cout << "socket " << delta << std::endl; });
+    _update.attach<ESubsystem::EReplication>([](float delta) { std::cout << "replication " << delta << std::endl; });
+    _update.attach<ESubsystem::EMixer>([](float delta) { std::cout << "mixer " << delta << std::endl; });
+    _update.attach<ESubsystem::EMusic>([](float delta) { std::cout << "music " << delta << std::endl; });
+    _update.attach<ESubsystem::ERenderer>([](float delta) { std::cout << "renderer " << delta << std::endl; });
+
+    //Only the network handlers, in order of the keys
+    _update.execute(g_Network, 0.016f);
+
+    //Muted handlers are skipped inside the category
+    _update.disable<ESubsystem::EMusic>();
+    _update.execute(g_Audio, 0.016f);
+
+    //Categories can be combined
+    _update.execute(g_Network | g_Audio, 0.033f);
+
+    TDelegateMulti<ESubsystem, int(int)> _budget;
+    _budget.attach<ESubsystem::EMixer>([](int frame) { return frame * 2; });
+    _budget.attach<ESubsystem::ERenderer>([](int frame) { return frame * 8; });
+    for (auto& [_key, _value] : _budget.eval(g_Audio, 10))
+    {
+        std::cout << "audio budget " << static_cast<int>(_key) << ": " << _value << std::endl;
+    }
+    return 0;
+}
@@ -3,26 +3,46 @@
 
 using namespace EasyDelegate;
 
-//    An important note. You cannot use TDelegateAny and TDelegateAnyCT at the 
-//    same time due to some technical problems. The same is the case with the 
-//    enumerator. When the problem is resolved, this will be indicated in the update.
-
-// If you want use multiple enums, start new enum with higher index
+//    Keys keep the type of their enumerator, so every enumerator can start from zero
+//    and TDelegateAny can be used together with TDelegateAnyCT.
 enum class EEnumerator
 {
-    EIntDelegate = 100,
-    EBoolDelegate
+    EIntDelegate,
+    EBoolDelegate,
+    EPrintDelegate,
+    EBoundDelegate
+};
+
+//Another enumerator with the same values, used with runtime container
+enum class ERuntimeEnumerator
+{
+    EFloatDelegate
 };
 
 //This declarations should be in cpp file
 DeclareDelegateFuncCompileTime(EEnumerator, EEnumerator::EIntDelegate, int(int, int, bool))
 DeclareDelegateFuncCompileTime(EEnumerator, EEnumerator::EBoolDelegate, bool(bool, bool))
+DeclareDelegateFuncCompileTime(EEnumerator, EEnumerator::EPrintDelegate, void(int))
+DeclareDelegateFuncRuntime(ERuntimeEnumerator, ERuntimeEnumerator::EFloatDelegate, float(float))
 
-        int foo(int x, int y, bool ts)
+int foo(int x, int y, bool ts)
 {
     return ts ? x : y;
 }
 
+int square(int x)
+{
+    return x * x;
+}
+
+int cube(int x)
+{
+    return x * x * x;
+}
+
+//Global delegate bound to the function at compile time, nothing is executed at startup
+DeclareDelegateFuncCompileTimeBound(EEnumerator, EEnumerator::EBoundDelegate, int(int), &square)
+
 class Foo
 {
 public:
@@ -58,5 +78,27 @@ int main()
 
     std::cout << lresult << std::endl;
 
+    //Executing by the key that is known only at runtime, for example read from config
+    TDelegateAnyCT<EEnumerator>::attach<EEnumerator::EPrintDelegate>([](int i)
+    {
+        std::cout << "Print " << i << std::endl;
+    });
+    uint32_t iConfigKey = 2;
+    auto eRuntimeKey = static_cast<EEnumerator>(iConfigKey);
+    TDelegateAnyCT<EEnumerator>::execute(eRuntimeKey, iresult);
+    //Returns false, because key has 'non-void' return type
+    TDelegateAnyCT<EEnumerator>::execute(EEnumerator::EIntDelegate, iresult);
+
+    //Bound delegate can be called without attach
+    std::cout << TDelegateAnyCT<EEnumerator>::eval<EEnumerator::EBoundDelegate>(7) << std::endl;
+    //Rebinding static function is a single atomic store, other threads can call the delegate meanwhile
+    TDelegateAnyCT<EEnumerator>::attach<EEnumerator::EBoundDelegate, &cube>();
+    std::cout << TDelegateAnyCT<EEnumerator>::eval<EEnumerator::EBoundDelegate>(3) << std::endl;
+
+    //Runtime container next to the global one
+    TDelegateAny<ERuntimeEnumerator> _delegates;
+    _delegates.attach<ERuntimeEnumerator::EFloatDelegate>([](float f) { return f * 2.f; });
+    std::cout << _delegates.eval<ERuntimeEnumerator::EFloatDelegate>(1.5f) << std::endl;
+
     return 0;
 }
\ No newline at end of file
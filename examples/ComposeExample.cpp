@@ -0,0 +1,50 @@
+#include <cmath>
+#include <iostream>
+#include <string>
+#include "EasyDelegate.hpp"
+
+using namespace EasyDelegate;
+
+enum class ETransform
+{
+    EClamp,
+    EPrint
+};
+
+DeclareDelegateFuncRuntime(ETransform, ETransform::EClamp, float(float))
+DeclareDelegateFuncRuntime(ETransform, ETransform::EPrint, void(float))
+
+float to_celsius(float fahrenheit)
+{
+    return (fahrenheit - 32.f) * 5.f / 9.f;
+}
+
+float round_half(float value)
+{
+    return std::round(value * 2.f) / 2.f;
+}
+
+int main()
+{
+    //Stages known at compile time are inlined into a single callable, one indirect call for the whole pipeline
+    TDelegate<float(float)> _convert(pipe(stage<&to_celsius>(), stage<&round_half>()));
+
+    //Same pipeline with operator |, lambdas can be mixed with functions
+    auto _clamp = pipe(stage<&to_celsius>()) | [](float value) { return std::fmax(value, 0.f); } | stage<&round_half>();
+
+    //compose applies stages from right to left, like nested calls
+    auto _describe = compose([](float value) { return "temperature " + std::to_string(value); }, stage<&round_half>(), stage<&to_celsius>());
+
+    //Pipelines bind into every container
+    TDelegateMulti<ETransform, float(float)> _multi;
+    _multi.attach<ETransform::EClamp>(_clamp);
+
+    TDelegateAny<ETransform> _any;
+    _any.attach<ETransform::EPrint>(pipe(stage<&to_celsius>(), [](float value) { std::cout << "print: " << value << std::endl; }));
+
+    std::cout << _convert(100.f) << std::endl;
+    std::cout << _multi.eval<ETransform::EClamp>(0.f) << std::endl;
+    std::cout << _describe(212.f) << std::endl;
+    _any.execute<ETransform::EPrint>(50.f);
+    return 0;
+}
@@ -0,0 +1,84 @@
+#include <atomic>
+#include <coroutine>
+#include <iostream>
+#include <string>
+#include <thread>
+#include "EasyDelegateCoroutineImpl.hpp"
+
+using namespace EasyDelegate;
+
+enum class ESessionEvent
+{
+    EConnected,
+    EMessage,
+    EClosed
+};
+
+//Minimal fire-and-forget coroutine type, any coroutine library works the same way
+struct FTask
+{
+    struct promise_type
+    {
+        FTask get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+using session_events_t = TAwaitableDelegateMulti<ESessionEvent, void(int, const std::string&)>;
+
+FTask session(session_events_t& events)
+{
+    //Resumes when execute<EConnected> fires, arguments are delivered as tuple
+    auto [id, address] = co_await events.next<ESessionEvent::EConnected>();
+    std::cout << "connected " << id << " from " << address << std::endl;
+
+    for (;;)
+    {
+        auto [from, text] = co_await events.next<ESessionEvent::EMessage>();
+        if (text == "bye")
+        {
+            break;
+        }
+        std::cout << "message from " << from << ": " << text << std::endl;
+    }
+    std::cout << "session finished" << std::endl;
+}
+
+int square(int x)
+{
+    return x * x;
+}
+
+FTask compute(TDelegate<int(int)>& _delegate, std::atomic<int>& result)
+{
+    //Call runs on the library thread pool, the coroutine continues on the worker thread
+    int value = co_await async_invoke(_delegate, 12);
+    result.store(value);
+}
+
+int main()
+{
+    session_events_t _events;
+    //Delegates and awaiting coroutines receive the same calls
+    _events.attach<ESessionEvent::EMessage>([](int, const std::string& text) { std::cout << "log: " << text << std::endl; });
+
+    session(_events);
+    _events.execute<ESessionEvent::EConnected>(1, std::string("127.0.0.1"));
+    _events.execute<ESessionEvent::EMessage>(1, std::string("hello"));
+    _events.execute<ESessionEvent::EMessage>(1, std::string("bye"));
+    //Nobody waits anymore
+    _events.execute<ESessionEvent::EMessage>(1, std::string("ignored"));
+
+    TDelegate<int(int)> _square(&square);
+    std::atomic<int> _result{0};
+    compute(_square, _result);
+    while (!_result.load())
+    {
+        std::this_thread::yield();
+    }
+    std::cout << "square: " << _result.load() << std::endl;
+    return 0;
+}
@@ -0,0 +1,59 @@
+#include <iostream>
+#include <string>
+#include <thread>
+#include "EasyDelegate.hpp"
+
+using namespace EasyDelegate;
+
+void log_message(const std::string& message, int frame)
+{
+    std::cout << "[" << frame << "] " << message << std::endl;
+}
+
+class FPlayer
+{
+public:
+    void damage(int amount)
+    {
+        health -= amount;
+    }
+
+    int health{100};
+};
+
+int main()
+{
+    TDelegate<void(const std::string&, int)> _logger(&log_message);
+    FPlayer _player;
+    TDelegate<void(int)> _damage(&_player, &FPlayer::damage);
+
+    //Queue stores calls in 4 kilobytes ring buffer
+    TDelegateDeferredQueue<4096> _queue;
+
+    for (int frame = 0; frame < 3; ++frame)
+    {
+        //Calls from the hot path are only recorded, arguments are copied into the queue
+        _queue.enqueue(_damage, 10);
+        _queue.enqueue(_logger, std::string("damage applied"), frame);
+
+        //Frame boundary, calls are invoked in order
+        _queue.flush();
+    }
+
+    //Calls can be queued by one thread and flushed by another
+    std::thread _producer([&]() 
+    {
+        for (int i = 0; i < 5; ++i)
+        {
+            while (!_queue.enqueue(_damage, 1))
+            {
+                std::this_thread::yield();
+            }
+        }
+    });
+    _producer.join();
+    _queue.flush();
+
+    std::cout << "health: " << _player.health << std::endl;
+    return 0;
+}
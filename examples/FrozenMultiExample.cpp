@@ -0,0 +1,46 @@
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "EasyDelegate.hpp"
+
+using namespace EasyDelegate;
+
+enum class EPass
+{
+    EShadow,
+    EOpaque,
+    ETransparent,
+    EDebug,
+    EPostProcess
+};
+
+int main()
+{
+    //Built once at startup
+    TDelegateMulti<EPass, void(int)> _passes;
+    _passes.attach<EPass::EShadow>([](int frame) { std::cout << "shadow " << frame << std::endl; });
+    _passes.attach<EPass::EOpaque>([](int frame) { std::cout << "opaque " << frame << std::endl; });
+    _passes.attach<EPass::ETransparent>([](int frame) { std::cout << "transparent " << frame << std::endl; });
+    _passes.attach<EPass::EDebug>([](int frame) { std::cout << "debug " << frame << std::endl; });
+    _passes.attach<EPass::EPostProcess>([](int frame) { std::cout << "post process " << frame << std::endl; });
+    _passes.disable<EPass::EDebug>();
+
+    //Muted keys are left out, the snapshot has no attach and detach
+    const auto _frozen = _passes.freeze();
+    std::cout << "frozen passes: " << _frozen.size() << std::endl;
+    _frozen.execute(1);
+    _frozen.execute<EPass::EOpaque>(2);
+    _frozen.execute(key_mask<EPass::EOpaque, EPass::ETransparent>(), 3);
+
+    //Read-only table is shared between threads without locks
+    std::vector<std::thread> _workers;
+    for (int _index = 0; _index < 2; ++_index)
+    {
+        _workers.emplace_back([&_frozen, _index]() { _frozen.execute<EPass::EShadow>(10 + _index); });
+    }
+    for (auto& _worker : _workers)
+    {
+        _worker.join();
+    }
+    return 0;
+}
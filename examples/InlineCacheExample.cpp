@@ -0,0 +1,34 @@
+#include <iostream>
+#include "EasyDelegate.hpp"
+
+using namespace EasyDelegate;
+
+int add(int x, int y)
+{
+    return x + y;
+}
+
+int multiply(int x, int y)
+{
+    return x * y;
+}
+
+int main()
+{
+    TTypedDelegate<int(int, int)> _hot(&add), _cold(&multiply);
+
+    //Static bindings expose the attached function, lambdas and methods return nullptr
+    std::cout << "raw target: " << (_hot.raw_target() == &add) << std::endl;
+    std::cout << "lambda raw target: " << (TTypedDelegate<int(int, int)>([](int x, int y) { return x - y; }).raw_target() == nullptr) << std::endl;
+
+    //Hit: add is called directly and inlined into the call site
+    std::cout << _hot.invoke_expect<&add>(2, 3) << std::endl;
+
+    //Miss: falls back to the regular delegate call
+    std::cout << _cold.invoke_expect<&add>(2, 3) << std::endl;
+
+    //Compile-time stages are static bindings too
+    TDelegate<int(int, int)> _stage(stage<&add>());
+    std::cout << _stage.invoke_expect<&add>(4, 5) << std::endl;
+    return 0;
+}
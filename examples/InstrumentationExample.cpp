@@ -0,0 +1,57 @@
+#include <iostream>
+#include <thread>
+#include "EasyDelegate.hpp"
+
+using namespace EasyDelegate;
+
+enum class EPhysicsDelegate
+{
+    EIntegrate,
+    ECollide
+};
+
+//Tag type that identifies the statistics
+struct FPhysicsStats {};
+using physics_policy_t = TDelegateInstrumentation<FPhysicsStats>;
+
+int main()
+{
+    //Container without policy, calls compile to plain calls
+    TDelegateMulti<EPhysicsDelegate, void(float)> _plain;
+
+    //Same container with recorded calls
+    TDelegateMulti<EPhysicsDelegate, void(float), __EnumeratorComp<EPhysicsDelegate>, physics_policy_t> _delegates;
+    _delegates.attach<EPhysicsDelegate::EIntegrate>([](float dt) { volatile float x = dt * 2.f; (void)x; });
+    _delegates.attach<EPhysicsDelegate::ECollide>([](float dt) { std::this_thread::sleep_for(std::chrono::microseconds(static_cast<int>(dt))); });
+
+    //Counters are kept per thread and merged on read
+    std::thread _worker([&_delegates]() 
+    {
+        for (int i = 0; i < 100; ++i)
+        {
+            _delegates.execute<EPhysicsDelegate::EIntegrate>(1.f);
+        }
+    });
+
+    for (int i = 0; i < 10; ++i)
+    {
+        _delegates.execute(50.f);
+    }
+    _worker.join();
+
+    for (auto eKey : {EPhysicsDelegate::EIntegrate, EPhysicsDelegate::ECollide})
+    {
+        auto _stats = physics_policy_t::stats(eKey);
+        std::cout << "key " << TakeKeyIndex(eKey) << ": " << _stats.calls << " calls, " << _stats.ticks << " ns total" << std::endl;
+        for (std::size_t bucket = 0; bucket < _stats.histogram.size(); ++bucket)
+        {
+            if (_stats.histogram[bucket])
+            {
+                std::cout << "  < 2^" << bucket << " ns: " << _stats.histogram[bucket] << std::endl;
+            }
+        }
+    }
+
+    physics_policy_t::reset();
+    return 0;
+}
@@ -0,0 +1,63 @@
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <thread>
+#include "EasyDelegate.hpp"
+
+using namespace EasyDelegate;
+
+//Pure and expensive function
+double price(const std::string& symbol, int quantity)
+{
+    double result = 0.0;
+    for (int i = 1; i <= 100000; ++i)
+    {
+        result += std::sqrt(static_cast<double>(i * quantity + static_cast<int>(symbol.size())));
+    }
+    return result;
+}
+
+class FLayout
+{
+public:
+    int measure(int width, int fontSize)
+    {
+        return width / fontSize + scale;
+    }
+
+    int scale{1};
+};
+
+int main()
+{
+    //Up to 256 results are kept, shared by all threads
+    TMemoDelegate<double(const std::string&, int)> _price(&price);
+    for (int i = 0; i < 10; ++i)
+    {
+        _price(std::string("EURUSD"), 100);
+        _price(std::string("GBPUSD"), i % 2 ? 100 : 200);
+    }
+    std::cout << "price hits: " << _price.hits() << ", misses: " << _price.misses() << std::endl;
+
+    //Every thread uses own cache of 64 results, no locking on the call
+    FLayout _layout;
+    TMemoDelegate<int(int, int), 64, true> _measure(&_layout, &FLayout::measure);
+    std::thread _worker([&_measure]() 
+    {
+        for (int i = 0; i < 100; ++i)
+        {
+            _measure(800, 12 + i % 4);
+        }
+    });
+    _worker.join();
+
+    //Data used by the method changed, cached results are dropped
+    _layout.scale = 2;
+    _measure.invalidate();
+    std::cout << "measure: " << _measure(800, 12) << ", hits: " << _measure.hits() << ", misses: " << _measure.misses() << std::endl;
+
+    //Re-attaching also drops cached results
+    _measure.attach([](int width, int fontSize) { return width * fontSize; });
+    std::cout << "measure: " << _measure(800, 12) << std::endl;
+    return 0;
+}
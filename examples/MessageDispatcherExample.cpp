@@ -0,0 +1,71 @@
+#include <iostream>
+#include <vector>
+#include "EasyDelegate.hpp"
+
+using namespace EasyDelegate;
+
+enum class EOpcode
+{
+    EMove,
+    EChat,
+    EPing
+};
+
+struct FVector
+{
+    float x, y, z;
+};
+
+//This declarations should be in cpp file
+DeclareDelegateFuncRuntime(EOpcode, EOpcode::EMove, void(uint32_t, const FVector&))
+DeclareDelegateFuncRuntime(EOpcode, EOpcode::EChat, void(uint32_t, char))
+DeclareDelegateFuncRuntime(EOpcode, EOpcode::EPing, void())
+
+//Stand-in for the network layer, stores (opcode, payload) pairs
+struct FMessage
+{
+    EOpcode opcode;
+    std::vector<std::byte> payload;
+};
+
+void move(uint32_t id, const FVector& pos)
+{
+    std::cout << "Move " << id << ": " << pos.x << " " << pos.y << " " << pos.z << std::endl;
+}
+
+int main()
+{
+    TDelegateAny<EOpcode> _handlers;
+    _handlers.attach<EOpcode::EMove>(&move);
+    _handlers.attach<EOpcode::EChat>([](uint32_t id, char c)
+    {
+        std::cout << "Chat " << id << ": " << c << std::endl;
+    });
+
+    //Declare dispatcher for the keys that can arrive from the network
+    using dispatcher_t = TDelegateDispatcher<EOpcode, EOpcode::EMove, EOpcode::EChat, EOpcode::EPing>;
+    dispatcher_t _dispatcher(_handlers);
+
+    //Packing messages the same way as the sender does
+    std::vector<FMessage> _queue;
+    FMessage _move{EOpcode::EMove, std::vector<std::byte>(dispatcher_t::payload_size<EOpcode::EMove>())};
+    dispatcher_t::encode<EOpcode::EMove>(_move.payload.data(), 7u, FVector{1.f, 2.f, 3.f});
+    _queue.push_back(_move);
+
+    FMessage _chat{EOpcode::EChat, std::vector<std::byte>(dispatcher_t::payload_size<EOpcode::EChat>())};
+    dispatcher_t::encode<EOpcode::EChat>(_chat.payload.data(), 7u, 'a');
+    _queue.push_back(_chat);
+
+    //Nothing attached to ping, dispatch returns false
+    _queue.push_back(FMessage{EOpcode::EPing, {}});
+
+    int handled{0};
+    for (auto &_message : _queue)
+    {
+        handled += _dispatcher.dispatch(_message.opcode, _message.payload) ? 1 : 0;
+    }
+
+    std::cout << handled << std::endl;
+
+    return handled == 2 ? 0 : 1;
+}
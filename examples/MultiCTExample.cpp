@@ -0,0 +1,68 @@
+#include <iostream>
+#include <string>
+#include "EasyDelegate.hpp"
+
+using namespace EasyDelegate;
+
+enum class EStage
+{
+    EDecode,
+    EValidate,
+    ELog
+};
+
+struct FPacket
+{
+    std::string payload;
+    int checksum;
+};
+
+void decode(const FPacket& packet)
+{
+    std::cout << "decode: " << packet.payload << std::endl;
+}
+
+void validate(const FPacket& packet)
+{
+    std::cout << "validate: " << (packet.checksum == static_cast<int>(packet.payload.size())) << std::endl;
+}
+
+void log_packet(const FPacket& packet)
+{
+    std::cout << "log: " << packet.checksum << std::endl;
+}
+
+int cost_cpu(int size)
+{
+    return size * 2;
+}
+
+int cost_io(int size)
+{
+    return size + 100;
+}
+
+//Whole pipeline is known at build time, nothing is stored and every call can be inlined
+using pipeline_t = TDelegateMultiCT<EStage, void(const FPacket&), 
+    TDelegateSlot<EStage::EDecode, &decode>, 
+    TDelegateSlot<EStage::EValidate, &validate>, 
+    TDelegateSlot<EStage::ELog, &log_packet>>;
+
+using cost_t = TDelegateMultiCT<EStage, int(int), 
+    TDelegateSlot<EStage::EDecode, &cost_cpu>, 
+    TDelegateSlot<EStage::ELog, &cost_io>>;
+
+int main()
+{
+    //Handlers are called in order of declaration, the packet is shared without copies
+    pipeline_t::execute(FPacket{"hello", 5});
+
+    //Call by key is resolved at compile time
+    pipeline_t::execute<EStage::ELog>(FPacket{"key", 3});
+
+    //Results are placed in order of declaration
+    auto _costs = cost_t::eval(10);
+    std::cout << "cpu: " << _costs[cost_t::index<EStage::EDecode>()] << ", io: " << _costs[cost_t::index<EStage::ELog>()] << std::endl;
+    std::cout << "validate bound: " << cost_t::contains<EStage::EValidate>() << std::endl;
+    return 0;
+}
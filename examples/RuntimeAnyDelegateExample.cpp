@@ -3,11 +3,8 @@
 
 using namespace EasyDelegate;
 
-//    An important note. You cannot use TDelegateAny and TDelegateAnyCT at the 
-//    same time due to some technical problems. The same is the case with the 
-//    enumerator. When the problem is resolved, this will be indicated in the update.
-
-// If you want use multiple enums, start new enum with higher index
+//    Keys keep the type of their enumerator, so every enumerator can start from zero
+//    and TDelegateAny can be used together with TDelegateAnyCT.
 enum class EEnumerator
 {
     EIntDelegate,
@@ -0,0 +1,50 @@
+#include <iostream>
+#include <thread>
+#include "EasyDelegate.hpp"
+
+using namespace EasyDelegate;
+
+enum class ENetworkDelegate
+{
+    EReceive,
+    ESave
+};
+
+//Tag type that identifies the detector
+struct FNetworkBudget {};
+using detector_t = TDelegateSlowDetector<FNetworkBudget>;
+
+int main()
+{
+    //Thresholds are in clock ticks, nanoseconds for the default clock
+    detector_t::threshold(1'000'000);
+    detector_t::threshold(ENetworkDelegate::ESave, 5'000'000);
+
+    TDelegateMulti<ENetworkDelegate, void(int), __EnumeratorComp<ENetworkDelegate>, detector_t> _handlers;
+    _handlers.attach<ENetworkDelegate::EReceive>([](int packet) 
+    {
+        //Handler blocks once in a while
+        if (packet == 3)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    });
+    _handlers.attach<ENetworkDelegate::ESave>([](int) { std::this_thread::sleep_for(std::chrono::milliseconds(2)); });
+
+    std::thread _worker([&_handlers]() 
+    {
+        for (int packet = 0; packet < 5; ++packet)
+        {
+            _handlers.execute(packet);
+        }
+    });
+    _worker.join();
+
+    //Monitoring thread drains the reports
+    detector_t::drain([](const detector_t::report_t& report)
+    {
+        std::cout << "key " << report.key << " took " << report.duration / 1000 << " us on thread " << report.thread << std::endl;
+    });
+    std::cout << "dropped: " << detector_t::dropped() << std::endl;
+    return 0;
+}
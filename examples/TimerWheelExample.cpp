@@ -0,0 +1,48 @@
+#include <chrono>
+#include <iostream>
+#include "EasyDelegate.hpp"
+
+using namespace EasyDelegate;
+
+class FConnection
+{
+public:
+    void timeout()
+    {
+        std::cout << "connection timed out" << std::endl;
+    }
+
+    void heartbeat()
+    {
+        ++heartbeats;
+    }
+
+    int heartbeats{0};
+};
+
+int main()
+{
+    FConnection _connection;
+
+    //Ticks are milliseconds here, the wheel only sees numbers passed to tick
+    TDelegateTimerWheel _timers;
+
+    //Fires once after 5 seconds unless cancelled
+    auto _timeout = _timers.schedule(5000, TDelegate<void()>(&_connection, &FConnection::timeout));
+    //Fires every second
+    auto _heartbeat = _timers.schedule_periodic(1000, TDelegate<void()>(&_connection, &FConnection::heartbeat));
+
+    //Manual clock, the same code can be driven by std::chrono::steady_clock
+    for (uint64_t now = 0; now <= 3000; now += 16)
+    {
+        _timers.tick(now);
+    }
+
+    //Response arrived, timeout is not needed anymore
+    _timers.cancel(_timeout);
+    _timers.tick(10000);
+    _timers.cancel(_heartbeat);
+
+    std::cout << "heartbeats: " << _connection.heartbeats << ", active timers: " << _timers.size() << std::endl;
+    return 0;
+}
@@ -0,0 +1,46 @@
+#include <iostream>
+#include <thread>
+#include "EasyDelegate.hpp"
+
+using namespace EasyDelegate;
+
+enum class EFrameDelegate
+{
+    EInput,
+    EUpdate,
+    ERender
+};
+
+//Tag type that identifies the trace
+struct FFrameTrace {};
+using trace_policy_t = TDelegateTracing<FFrameTrace>;
+
+int main()
+{
+    //TDelegate records calls under its own key index, apart from the enumerator keys
+    trace_policy_t::name(DelegateKeyIndex, "Culling");
+    trace_policy_t::name(EFrameDelegate::EInput, "Input");
+    trace_policy_t::name(EFrameDelegate::EUpdate, "Update");
+    trace_policy_t::name(EFrameDelegate::ERender, "Render");
+
+    TDelegateMulti<EFrameDelegate, void(int), __EnumeratorComp<EFrameDelegate>, trace_policy_t> _frame;
+
+    //Nested delegate is shown inside of the render event
+    TDelegate<void(int), trace_policy_t> _culling([](int) { std::this_thread::sleep_for(std::chrono::microseconds(50)); });
+
+    _frame.attach<EFrameDelegate::EInput>([](int) { std::this_thread::sleep_for(std::chrono::microseconds(20)); });
+    _frame.attach<EFrameDelegate::EUpdate>([](int) { std::this_thread::sleep_for(std::chrono::microseconds(100)); });
+    _frame.attach<EFrameDelegate::ERender>([&_culling](int frame) { _culling(frame); });
+
+    for (int frame = 0; frame < 3; ++frame)
+    {
+        _frame.execute(frame);
+    }
+
+    //Open the file in chrome://tracing or ui.perfetto.dev
+    if (trace_policy_t::flush("delegate_trace.json"))
+    {
+        std::cout << "Trace written to delegate_trace.json" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,464 @@
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <tuple>
+#include <vector>
+#include "EasyDelegate.hpp"
+#include "TestHarness.hpp"
+#if defined(_MSC_VER)
+#include <malloc.h>
+#endif
+
+using namespace EasyDelegate;
+using namespace EasyDelegateTest;
+
+// Replaces global operator new/delete with counting versions and checks heap allocations of every 
+// public operation in steady state. Adding an allocation to a dispatch path makes this test fail.
+
+namespace
+{
+    std::atomic<unsigned long> g_Allocations{0};
+
+    //Counts allocations made by the body
+    template<class _Function>
+    unsigned long allocations(_Function&& body)
+    {
+        const unsigned long before = g_Allocations.load();
+        body();
+        return g_Allocations.load() - before;
+    }
+
+#if defined(_MSC_VER)
+#define TEST_NOINLINE __declspec(noinline)
+#else
+#define TEST_NOINLINE __attribute__((noinline))
+#endif
+
+    TEST_NOINLINE void release(void* ptr) noexcept
+    {
+        std::free(ptr);
+    }
+
+    //MSVC has no std::aligned_alloc, its aligned blocks are released only by _aligned_free
+    void* aligned_allocate(std::size_t size, std::size_t align) noexcept
+    {
+#if defined(_MSC_VER)
+        return _aligned_malloc(size ? size : 1, align);
+#else
+        return std::aligned_alloc(align, ((size ? size : 1) + align - 1) / align * align);
+#endif
+    }
+
+    TEST_NOINLINE void aligned_release(void* ptr) noexcept
+    {
+#if defined(_MSC_VER)
+        _aligned_free(ptr);
+#else
+        std::free(ptr);
+#endif
+    }
+
+    void expect_allocations(const char* name, unsigned long actual, unsigned long expected)
+    {
+        if (actual != expected)
+        {
+            std::fprintf(stderr, "FAILED %s: %lu allocations, expected %lu\n", name, actual, expected);
+            ++g_Failures;
+        }
+    }
+
+    void expect_at_most(const char* name, unsigned long actual, unsigned long limit)
+    {
+        if (actual > limit)
+        {
+            std::fprintf(stderr, "FAILED %s: %lu allocations, expected at most %lu\n", name, actual, limit);
+            ++g_Failures;
+        }
+    }
+}
+
+//Replacement of every global allocation function, so each allocation is counted and every pointer is released 
+//by the function matching its allocation. The blocks are released through out-of-line functions, 
+//otherwise GCC inlines std::free into the callers and pairs it with the replaced operator new.
+void* operator new(std::size_t size)
+{
+    g_Allocations.fetch_add(1);
+    if (void* ptr = std::malloc(size ? size : 1))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    g_Allocations.fetch_add(1);
+    return std::malloc(size ? size : 1);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept
+{
+    return operator new(size, tag);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    g_Allocations.fetch_add(1);
+    if (void* ptr = aligned_allocate(size, static_cast<std::size_t>(alignment)))
+    {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return operator new(size, alignment);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+    g_Allocations.fetch_add(1);
+    return aligned_allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t& tag) noexcept
+{
+    return operator new(size, alignment, tag);
+}
+
+void operator delete(void* ptr) noexcept
+{
+    release(ptr);
+}
+
+void operator delete[](void* ptr) noexcept
+{
+    release(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+    release(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept
+{
+    release(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept
+{
+    release(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept
+{
+    release(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+    aligned_release(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t) noexcept
+{
+    aligned_release(ptr);
+}
+
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    aligned_release(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept
+{
+    aligned_release(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    aligned_release(ptr);
+}
+
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept
+{
+    aligned_release(ptr);
+}
+
+enum class EKey
+{
+    EFirst,
+    ESecond,
+    EThird
+};
+
+enum class EGlobalKey
+{
+    EInt,
+    EVoid,
+    EBound
+};
+
+int add(int x, int y)
+{
+    return x + y;
+}
+
+int sum = 0;
+
+void accumulate(int x, int y)
+{
+    sum += x + y;
+}
+
+class FAdder
+{
+public:
+    int add(int x, int y)
+    {
+        return x + y;
+    }
+};
+
+DeclareDelegateFuncRuntime(EKey, EKey::EFirst, int(int, int))
+DeclareDelegateFuncRuntime(EKey, EKey::ESecond, void(int, int))
+
+DeclareDelegateFuncCompileTime(EGlobalKey, EGlobalKey::EInt, int(int, int))
+DeclareDelegateFuncCompileTime(EGlobalKey, EGlobalKey::EVoid, void(int, int))
+DeclareDelegateFuncCompileTimeBound(EGlobalKey, EGlobalKey::EBound, int(int, int), &add)
+
+void test_replacement()
+{
+    //Every allocation function is counted, otherwise over-aligned or nothrow allocations would pass unnoticed. 
+    //Pointers are kept in volatile locals, so the compiler cannot elide the pairs.
+    struct alignas(64) FAligned
+    {
+        char data[64];
+    };
+    expect_allocations("operator new", allocations([] { int* volatile ptr = new int(1); delete ptr; }), 1);
+    expect_allocations("operator new[]", allocations([] { int* volatile ptr = new int[4]; delete[] ptr; }), 1);
+    expect_allocations("operator new(nothrow)", allocations([] { int* volatile ptr = new (std::nothrow) int(1); delete ptr; }), 1);
+    expect_allocations("operator new(align_val_t)", allocations([] { FAligned* volatile ptr = new FAligned(); delete ptr; }), 1);
+    expect_allocations("operator new[](align_val_t)", allocations([] { FAligned* volatile ptr = new FAligned[2]; delete[] ptr; }), 1);
+    expect_allocations("operator new(align_val_t, nothrow)", allocations([] { FAligned* volatile ptr = new (std::nothrow) FAligned(); delete ptr; }), 1);
+}
+
+void test_delegate()
+{
+    FAdder adder;
+    std::array<char, 64> large{};
+
+    TDelegate<int(int, int)> function;
+    expect_allocations("TDelegate::attach(function)", allocations([&] { function.attach(&add); }), 0);
+    expect_allocations("TDelegate::operator()(function)", allocations([&] { function(1, 2); }), 0);
+
+    TDelegate<int(int, int)> method;
+    expect_at_most("TDelegate::attach(method)", allocations([&] { method.attach(&adder, &FAdder::add); }), 1);
+    expect_allocations("TDelegate::operator()(method)", allocations([&] { method(1, 2); }), 0);
+
+    TDelegate<int(int, int)> lambda;
+    expect_at_most("TDelegate::attach(large lambda)", allocations([&] { lambda.attach([large](int x, int y) { return x + y + large[0]; }); }), 1);
+    expect_allocations("TDelegate::operator()(large lambda)", allocations([&] { lambda(1, 2); }), 0);
+    expect_allocations("TDelegate copy(function)", allocations([&] { TDelegate<int(int, int)> copy(function); copy(1, 2); }), 0);
+    std::array<std::tuple<int, int>, 16> rows{};
+    std::array<int, 16> xs{}, ys{}, results{};
+    expect_allocations("TDelegate::invoke_expect(function)", allocations([&] { function.invoke_expect<&add>(1, 2); }), 0);
+    expect_allocations("TDelegate::invoke_expect(method)", allocations([&] { method.invoke_expect<&add>(1, 2); }), 0);
+    TDelegate<int(int, int)> bound;
+    expect_allocations("TDelegate::attach<method>(object)", allocations([&] { bound.attach<&FAdder::add>(&adder); }), 0);
+    expect_allocations("TDelegate::operator()(bound method)", allocations([&] { bound(1, 2); }), 0);
+    TDelegate<int(int)> partial;
+    expect_allocations("TDelegate::attach(bind_front<method>)", allocations([&] { partial.attach(bind_front<&FAdder::add>(&adder, 1)); }), 0);
+    expect_allocations("TDelegate::attach(reorder)", allocations([&] { function.attach(reorder<1, 0>(&add)); }), 0);
+    expect_allocations("TDelegate::attach(bind_back<function>)", allocations([&] { partial.attach(bind_back<&add>(1)); }), 0);
+    expect_allocations("TDelegate::attach<method>(object, value)", allocations([&] { partial.attach<&FAdder::add>(&adder, 1); partial(2); }), 0);
+    expect_allocations("TDelegate move(large lambda)", allocations([&] { TDelegate<int(int, int)> moved(std::move(lambda)); moved(1, 2); }), 0);
+
+    //Rebinding through the TDelegate base would leave the remembered function stale
+    static_assert(!std::is_convertible<TTypedDelegate<int(int, int)> &, TDelegate<int(int, int)> &>::value, "TTypedDelegate should rebind only through attach.");
+    TTypedDelegate<int(int, int)> typed(&add), typedMethod(&adder, &FAdder::add);
+    expect_allocations("TTypedDelegate::invoke_batch(function)", allocations([&] { typed.invoke_batch(rows.data(), rows.size(), results.data()); }), 0);
+    expect_allocations("TTypedDelegate::invoke_batch_soa(method)", allocations([&] { typedMethod.invoke_batch_soa(xs.size(), results.data(), xs.data(), ys.data()); }), 0);
+    expect_allocations("TTypedDelegate::invoke_expect(function)", allocations([&] { typed.invoke_expect<&add>(1, 2); }), 0);
+}
+
+void test_multi()
+{
+    TDelegateMulti<EKey, void(int, int)> multi;
+    multi.attach<EKey::EFirst>(&accumulate);
+    multi.attach<EKey::ESecond>(&accumulate);
+    multi.attach<EKey::EThird>(&accumulate);
+
+    expect_allocations("TDelegateMulti::execute<key>", allocations([&] { multi.execute<EKey::ESecond>(1, 2); }), 0);
+    expect_allocations("TDelegateMulti::execute", allocations([&] { multi.execute(1, 2); }), 0);
+
+    TDelegateMulti<EKey, int(int, int)> multiEval;
+    multiEval.attach<EKey::EFirst>(&add);
+    multiEval.attach<EKey::ESecond>(&add);
+
+    expect_allocations("TDelegateMulti::eval<key>", allocations([&] { multiEval.eval<EKey::ESecond>(1, 2); }), 0);
+    //One node of the result map per attached delegate
+    expect_at_most("TDelegateMulti::eval", allocations([&] { multiEval.eval(1, 2); }), 2);
+}
+
+void test_multi_mask()
+{
+    TDelegateMulti<EKey, void(int, int)> multi;
+    multi.attach<EKey::EFirst>(&accumulate);
+    multi.attach<EKey::ESecond>(&accumulate);
+    multi.attach<EKey::EThird>(&accumulate);
+    const auto& category = key_mask<EKey::EFirst, EKey::EThird>();
+
+    //Bits of the muted keys are set up front, calls only read them
+    multi.disable<EKey::ESecond>();
+    expect_allocations("TDelegateMulti::execute(muted key)", allocations([&] { multi.execute(1, 2); }), 0);
+    expect_allocations("TDelegateMulti::execute<muted key>", allocations([&] { multi.execute<EKey::ESecond>(1, 2); }), 0);
+    expect_allocations("TDelegateMulti::execute(category)", allocations([&] { multi.execute(category, 1, 2); }), 0);
+    multi.enable_all();
+    expect_allocations("TDelegateMulti::execute(category, all enabled)", allocations([&] { multi.execute(category, 1, 2); }), 0);
+
+    TDelegateMulti<EKey, int(int, int)> multiEval;
+    multiEval.attach<EKey::EFirst>(&add);
+    multiEval.attach<EKey::ESecond>(&add);
+    //One node of the result map per key of the category
+    expect_at_most("TDelegateMulti::eval(category)", allocations([&] { multiEval.eval(category, 1, 2); }), 1);
+}
+
+void test_frozen()
+{
+    TDelegateMulti<EKey, void(int, int)> multi;
+    multi.attach<EKey::EFirst>(&accumulate);
+    multi.attach<EKey::ESecond>(&accumulate);
+    multi.attach<EKey::EThird>(&accumulate);
+    const auto& category = key_mask<EKey::EFirst, EKey::EThird>();
+    const auto frozen = multi.freeze();
+
+    expect_allocations("TFrozenDelegateMulti::execute<key>", allocations([&] { frozen.execute<EKey::ESecond>(1, 2); }), 0);
+    expect_allocations("TFrozenDelegateMulti::execute", allocations([&] { frozen.execute(1, 2); }), 0);
+    expect_allocations("TFrozenDelegateMulti::execute(category)", allocations([&] { frozen.execute(category, 1, 2); }), 0);
+
+    TDelegateMulti<EKey, int(int, int)> multiEval;
+    multiEval.attach<EKey::EFirst>(&add);
+    multiEval.attach<EKey::ESecond>(&add);
+    const auto frozenEval = multiEval.freeze();
+
+    expect_allocations("TFrozenDelegateMulti::eval<key>", allocations([&] { frozenEval.eval<EKey::ESecond>(1, 2); }), 0);
+    //One node of the result map per frozen delegate
+    expect_at_most("TFrozenDelegateMulti::eval", allocations([&] { frozenEval.eval(1, 2); }), 2);
+    expect_at_most("TFrozenDelegateMulti::eval(category)", allocations([&] { frozenEval.eval(category, 1, 2); }), 1);
+}
+
+void test_multi_ct()
+{
+    using multi_t = TDelegateMultiCT<EKey, void(int, int), TDelegateSlot<EKey::EThird, &accumulate>, TDelegateSlot<EKey::EFirst, &accumulate>>;
+    expect_allocations("TDelegateMultiCT::execute<key>", allocations([&] { multi_t::execute<EKey::EFirst>(1, 2); }), 0);
+    expect_allocations("TDelegateMultiCT::execute", allocations([&] { multi_t::execute(1, 2); }), 0);
+
+    using eval_t = TDelegateMultiCT<EKey, int(int, int), TDelegateSlot<EKey::ESecond, &add>, TDelegateSlot<EKey::EFirst, &add>>;
+    expect_allocations("TDelegateMultiCT::eval<key>", allocations([&] { eval_t::eval<EKey::ESecond>(1, 2); }), 0);
+    expect_allocations("TDelegateMultiCT::eval", allocations([&] { eval_t::eval(1, 2); }), 0);
+}
+
+void test_any()
+{
+    std::array<char, 64> large{};
+    TDelegateAny<EKey> any;
+    any.attach<EKey::EFirst>([large](int x, int y) { return x + y + large[0]; });
+    any.attach<EKey::ESecond>(&accumulate);
+
+    expect_allocations("TDelegateAny::eval<key>(large lambda)", allocations([&] { any.eval<EKey::EFirst>(1, 2); }), 0);
+    expect_allocations("TDelegateAny::execute<key>", allocations([&] { any.execute<EKey::ESecond>(1, 2); }), 0);
+    expect_allocations("TDelegateAny::find<key>", allocations([&] { any.find<EKey::EFirst>(); }), 0);
+
+    TDelegateDispatcher<EKey, EKey::EFirst, EKey::ESecond> dispatcher(any);
+    std::array<std::byte, 8> payload{};
+    decltype(dispatcher)::encode<EKey::ESecond>(payload.data(), 1, 2);
+    expect_allocations("TDelegateDispatcher::dispatch", allocations([&] { dispatcher.dispatch(EKey::ESecond, payload); }), 0);
+}
+
+void test_any_ct()
+{
+    using any_ct_t = TDelegateAnyCT<EGlobalKey>;
+    std::array<char, 64> large{};
+
+    expect_allocations("TDelegateAnyCT::attach<key, function>", allocations([&] { any_ct_t::attach<EGlobalKey::EVoid, &accumulate>(); }), 0);
+    expect_allocations("TDelegateAnyCT::execute<key>", allocations([&] { any_ct_t::execute<EGlobalKey::EVoid>(1, 2); }), 0);
+    expect_allocations("TDelegateAnyCT::execute(runtime key)", allocations([&] { any_ct_t::execute(EGlobalKey::EVoid, 1, 2); }), 0);
+    expect_allocations("TDelegateAnyCT::eval<key>(bound)", allocations([&] { any_ct_t::eval<EGlobalKey::EBound>(1, 2); }), 0);
+
+    FAdder adder;
+    expect_allocations("TDelegateAnyCT::attach<key>(function)", allocations([&] { any_ct_t::attach<EGlobalKey::EInt>(&add); }), 0);
+    expect_allocations("TDelegateAnyCT::eval<key>(function)", allocations([&] { any_ct_t::eval<EGlobalKey::EInt>(1, 2); }), 0);
+    expect_allocations("TDelegateAnyCT::attach<key>(method)", allocations([&] { any_ct_t::attach<EGlobalKey::EInt>(&adder, &FAdder::add); }), 0);
+    expect_allocations("TDelegateAnyCT::eval<key>(method)", allocations([&] { any_ct_t::eval<EGlobalKey::EInt>(1, 2); }), 0);
+    expect_allocations("TDelegateAnyCT::attach<key>(small lambda)", allocations([&] { any_ct_t::attach<EGlobalKey::EInt>([&adder](int x, int y) { return adder.add(x, y); }); }), 0);
+
+    expect_allocations("TDelegateAnyCT::attach<key>(large lambda)", allocations([&] 
+    { 
+        any_ct_t::attach<EGlobalKey::EInt>([large](int x, int y) { return x + y + large[0]; }); 
+    }), 1);
+    expect_allocations("TDelegateAnyCT::eval<key>(large lambda)", allocations([&] { any_ct_t::eval<EGlobalKey::EInt>(1, 2); }), 0);
+    expect_allocations("TDelegateAnyCT::detach<key>", allocations([&] { any_ct_t::detach<EGlobalKey::EInt>(); }), 0);
+}
+
+void test_deferred()
+{
+    static TDelegateDeferredQueue<4096> queue;
+    TDelegate<void(int, int)> function(&accumulate);
+    expect_allocations("TDelegateDeferredQueue::enqueue", allocations([&] { queue.enqueue(function, 1, 2); }), 0);
+    expect_allocations("TDelegateDeferredQueue::flush", allocations([&] { queue.flush(); }), 0);
+    //Wrapping around the ring
+    expect_allocations("TDelegateDeferredQueue::enqueue/flush wrap", allocations([&] 
+    {
+        for (int i = 0; i < 1000; ++i)
+        {
+            queue.enqueue(function, i, i);
+            queue.flush();
+        }
+    }), 0);
+}
+
+void test_async()
+{
+    TDelegate<int(int, int)> function(&add);
+    //First call starts the library thread pool
+    function.invoke_async(1, 2).get();
+    expect_allocations("TDelegate::invoke_async", allocations([&] { function.invoke_async(1, 2).get(); }), 0);
+}
+
+void test_memo()
+{
+    static TMemoDelegate<int(int, int)> shared(&add);
+    static TMemoDelegate<int(int, int), 64, true> local(&add);
+    shared(1, 2);
+    local(1, 2);
+    expect_allocations("TMemoDelegate::operator()(hit)", allocations([&] { shared(1, 2); }), 0);
+    expect_allocations("TMemoDelegate::operator()(miss)", allocations([&] { shared(3, 4); }), 0);
+    expect_allocations("TMemoDelegate::operator()(per-thread hit)", allocations([&] { local(1, 2); }), 0);
+}
+
+int main()
+{
+    test_replacement();
+    test_delegate();
+    test_multi();
+    test_multi_mask();
+    test_frozen();
+    test_multi_ct();
+    test_any();
+    test_any_ct();
+    test_deferred();
+    test_async();
+    test_memo();
+
+    return finish("allocation");
+}
@@ -0,0 +1,149 @@
+#include <vector>
+#include "EasyDelegate.hpp"
+#include "TestHarness.hpp"
+
+using namespace EasyDelegate;
+using namespace EasyDelegateTest;
+
+// Executes TDelegateAnyCT by runtime keys and checks that every key reaches its own handler, including keys of an enumerator
+// with a specialized __DelegateKeyRange and keys declared after the function that executes them, and that detached, undeclared, 
+// value-returning and out of range keys are reported, not called.
+
+enum class EEvent
+{
+    EFirst,
+    ESecond,
+    EThird,
+    EValue,
+    EUndeclared,
+    EFar = 100
+};
+
+enum class EShiftedEvent
+{
+    ELow = 10,
+    EHigh = 200,
+    EOutside = 9
+};
+
+enum class EStrictEvent
+{
+    EOnly
+};
+
+enum class ELateEvent
+{
+    EEarly,
+    ELate
+};
+
+template<>
+struct EasyDelegate::__DelegateKeyRange<EShiftedEvent>
+{
+    static constexpr uint32_t first = 10;
+    static constexpr uint32_t last = 200;
+};
+
+template<>
+struct EasyDelegate::__DelegateStrictKeys<EStrictEvent> : std::true_type {};
+
+std::vector<int> g_Calls;
+
+void first(int x)
+{
+    g_Calls.push_back(100 + x);
+}
+
+DeclareDelegateFuncCompileTime(EEvent, EEvent::EFirst, void(int))
+DeclareDelegateFuncCompileTime(EEvent, EEvent::ESecond, void(int))
+DeclareDelegateFuncCompileTime(EEvent, EEvent::EThird, void(int))
+DeclareDelegateFuncCompileTime(EEvent, EEvent::EValue, int(int))
+DeclareDelegateFuncCompileTime(EEvent, EEvent::EFar, void(int))
+DeclareDelegateFuncCompileTime(EShiftedEvent, EShiftedEvent::ELow, void(int))
+DeclareDelegateFuncCompileTime(EShiftedEvent, EShiftedEvent::EHigh, void(int))
+DeclareDelegateFuncCompileTimeBound(EStrictEvent, EStrictEvent::EOnly, void(int), &first)
+
+void test_runtime_keys()
+{
+    using any_ct_t = TDelegateAnyCT<EEvent>;
+    g_Calls.clear();
+    any_ct_t::attach<EEvent::EFirst, &first>();
+    any_ct_t::attach<EEvent::ESecond>([](int x) { g_Calls.push_back(200 + x); });
+    any_ct_t::attach<EEvent::EValue>([](int x) { g_Calls.push_back(-1); return x; });
+    any_ct_t::attach<EEvent::EFar>([](int) { g_Calls.push_back(-1); });
+
+    //Keys from a config or a network message
+    const std::vector<EEvent> keys{EEvent::ESecond, EEvent::EFirst, EEvent::ESecond};
+    for (std::size_t i = 0; i < keys.size(); ++i)
+    {
+        expect_equal("declared key called", any_ct_t::execute(keys[i], static_cast<int>(i)), 1);
+    }
+    expect_calls("runtime key order", g_Calls, {200, 101, 202});
+
+    g_Calls.clear();
+    expect_equal("detached key", static_cast<int>(any_ct_t::try_execute(EEvent::EThird, 1)), static_cast<int>(EDelegateKeyStatus::EDetached));
+    expect_equal("undeclared key", static_cast<int>(any_ct_t::try_execute(EEvent::EUndeclared, 1)), static_cast<int>(EDelegateKeyStatus::EUnknownKey));
+    expect_equal("value key", static_cast<int>(any_ct_t::try_execute(EEvent::EValue, 1)), static_cast<int>(EDelegateKeyStatus::EUnknownKey));
+    expect_equal("other arguments", static_cast<int>(any_ct_t::try_execute(EEvent::EFirst, "text")), static_cast<int>(EDelegateKeyStatus::EUnknownKey));
+    expect_equal("declared key out of range", static_cast<int>(any_ct_t::try_execute(EEvent::EFar, 1)), static_cast<int>(EDelegateKeyStatus::EOutOfRange));
+    expect_equal("garbage key out of range", static_cast<int>(any_ct_t::try_execute(static_cast<EEvent>(-5), 1)), static_cast<int>(EDelegateKeyStatus::EOutOfRange));
+    expect_equal("execute of out of range key", any_ct_t::execute(EEvent::EFar, 1), 0);
+    expect_calls("failed keys call nothing", g_Calls, {});
+
+    //The key stays reachable through the template parameter
+    any_ct_t::execute<EEvent::EFar>(1);
+    expect_calls("out of range key by template", g_Calls, {-1});
+}
+
+void test_shifted_range()
+{
+    using any_ct_t = TDelegateAnyCT<EShiftedEvent>;
+    g_Calls.clear();
+    any_ct_t::attach<EShiftedEvent::ELow>([](int x) { g_Calls.push_back(10 + x); });
+    any_ct_t::attach<EShiftedEvent::EHigh>([](int x) { g_Calls.push_back(200 + x); });
+
+    expect_equal("first key of range", static_cast<int>(any_ct_t::try_execute(EShiftedEvent::ELow, 1)), static_cast<int>(EDelegateKeyStatus::ECalled));
+    expect_equal("last key of range", static_cast<int>(any_ct_t::try_execute(EShiftedEvent::EHigh, 2)), static_cast<int>(EDelegateKeyStatus::ECalled));
+    expect_equal("key below range", static_cast<int>(any_ct_t::try_execute(EShiftedEvent::EOutside, 3)), static_cast<int>(EDelegateKeyStatus::EOutOfRange));
+    expect_equal("key above range", static_cast<int>(any_ct_t::try_execute(static_cast<EShiftedEvent>(201), 4)), static_cast<int>(EDelegateKeyStatus::EOutOfRange));
+    expect_calls("shifted range calls", g_Calls, {11, 202});
+}
+
+void test_strict_keys()
+{
+    static_assert(IsDeclarableKey(EStrictEvent::EOnly), "Key inside of the range should be declarable.");
+    static_assert(!IsDeclarableKey(static_cast<EStrictEvent>(64)), "Strict enumerator should reject keys outside of the range.");
+    static_assert(IsDeclarableKey(EEvent::EFar), "Keys of other enumerators are not checked.");
+
+    g_Calls.clear();
+    expect_equal("strict bound key", TDelegateAnyCT<EStrictEvent>::execute(EStrictEvent::EOnly, 5), 1);
+    expect_calls("strict bound calls", g_Calls, {105});
+}
+
+//The table is built when the translation unit is complete, the key declared below is part of it
+void execute_late(int x)
+{
+    TDelegateAnyCT<ELateEvent>::execute(ELateEvent::ELate, x);
+}
+
+DeclareDelegateFuncCompileTime(ELateEvent, ELateEvent::EEarly, void(int))
+DeclareDelegateFuncCompileTime(ELateEvent, ELateEvent::ELate, void(int))
+
+void test_late_declaration()
+{
+    g_Calls.clear();
+    expect_equal("late key detached", static_cast<int>(TDelegateAnyCT<ELateEvent>::try_execute(ELateEvent::ELate, 1)), static_cast<int>(EDelegateKeyStatus::EDetached));
+    TDelegateAnyCT<ELateEvent>::attach<ELateEvent::ELate>([](int x) { g_Calls.push_back(x); });
+    execute_late(7);
+    expect_calls("late key called", g_Calls, {7});
+}
+
+int main()
+{
+    test_runtime_keys();
+    test_shifted_range();
+    test_strict_keys();
+    test_late_declaration();
+
+    return finish("any compile time");
+}
@@ -0,0 +1,129 @@
+#include <type_traits>
+#include <vector>
+#include "EasyDelegate.hpp"
+#include "TestHarness.hpp"
+
+using namespace EasyDelegate;
+using namespace EasyDelegateTest;
+
+// Attaches, detaches and re-attaches delegates of TDelegateAny and checks that every call reaches the delegate attached last,
+// that detached keys have no stored delegate and that detaching one key leaves the others attached. Keys of another enumerator
+// with equal values are declared for TDelegateAnyCT in the same program and must keep their own signatures and delegates.
+
+enum class EAnyKey
+{
+    EValue,
+    EEvent,
+    EOther
+};
+
+DeclareDelegateFuncRuntime(EAnyKey, EAnyKey::EValue, int(int))
+DeclareDelegateFuncRuntime(EAnyKey, EAnyKey::EEvent, void(int))
+DeclareDelegateFuncRuntime(EAnyKey, EAnyKey::EOther, int(int))
+
+//Same values as EAnyKey, declared for the compile-time container
+enum class ECompileKey
+{
+    EValue,
+    EEvent
+};
+
+DeclareDelegateFuncCompileTime(ECompileKey, ECompileKey::EValue, int(int, int))
+DeclareDelegateFuncCompileTime(ECompileKey, ECompileKey::EEvent, void(int, int))
+
+namespace
+{
+    int twice(int x)
+    {
+        return x * 2;
+    }
+
+    struct FScale
+    {
+        int scale(int x) { return x * factor; }
+
+        int factor{10};
+    };
+}
+
+void test_reattach()
+{
+    TDelegateAny<EAnyKey> delegates;
+    delegates.attach<EAnyKey::EValue>(&twice);
+    delegates.attach<EAnyKey::EOther>(&twice);
+    expect_equal("function", delegates.eval<EAnyKey::EValue>(3), 6);
+
+    delegates.detach<EAnyKey::EValue>();
+    expect_equal("detached key has no delegate", delegates.find<EAnyKey::EValue>() == nullptr, true);
+    expect_equal("other key stays attached", delegates.eval<EAnyKey::EOther>(4), 8);
+
+    //Every kind of attach works again after detach
+    delegates.attach<EAnyKey::EValue>([](int x) { return x + 1; });
+    expect_equal("lambda after detach", delegates.eval<EAnyKey::EValue>(3), 4);
+
+    FScale scale;
+    delegates.detach<EAnyKey::EValue>();
+    delegates.attach<EAnyKey::EValue>(&scale, &FScale::scale);
+    expect_equal("method after detach", delegates.eval<EAnyKey::EValue>(3), 30);
+
+    delegates.detach<EAnyKey::EValue>();
+    delegates.attach<EAnyKey::EValue>(TDelegate<int(int)>(&twice));
+    expect_equal("delegate after detach", delegates.eval<EAnyKey::EValue>(5), 10);
+
+    //Detaching a key that was never attached does nothing
+    delegates.detach<EAnyKey::EEvent>();
+    expect_equal("other key after detach of missing key", delegates.eval<EAnyKey::EOther>(1), 2);
+}
+
+void test_reattach_void()
+{
+    std::vector<int> calls;
+    TDelegateAny<EAnyKey> delegates;
+    delegates.attach<EAnyKey::EEvent>([&calls](int x) { calls.push_back(x); });
+    delegates.execute<EAnyKey::EEvent>(1);
+    delegates.detach<EAnyKey::EEvent>();
+    expect_equal("detached void key has no delegate", delegates.find<EAnyKey::EEvent>() == nullptr, true);
+
+    delegates.attach<EAnyKey::EEvent>([&calls](int x) { calls.push_back(x * 10); });
+    delegates.execute<EAnyKey::EEvent>(3);
+    expect_calls("void key after re-attach", calls, {1, 30});
+}
+
+void test_equal_values()
+{
+    static_assert(TakeKeyIndex(EAnyKey::EValue) == TakeKeyIndex(ECompileKey::EValue), "Keys should have equal values.");
+    static_assert(std::is_same<__DelegateTypeStore<TakeStoreKey<EAnyKey, EAnyKey::EValue>()>::signature, int(int)>::value, "Runtime key lost its signature.");
+    static_assert(std::is_same<__DelegateTypeStore<TakeStoreKey<ECompileKey, ECompileKey::EValue>()>::signature, int(int, int)>::value, "Compile-time key lost its signature.");
+
+    std::vector<int> calls;
+    TDelegateAny<EAnyKey> runtime;
+    runtime.attach<EAnyKey::EValue>(&twice);
+    runtime.attach<EAnyKey::EEvent>([&calls](int x) { calls.push_back(x); });
+
+    using compile_t = TDelegateAnyCT<ECompileKey>;
+    compile_t::attach<ECompileKey::EValue>([](int x, int y) { return x * 100 + y; });
+    compile_t::attach<ECompileKey::EEvent>([&calls](int x, int y) { calls.push_back(x * 100 + y); });
+
+    expect_equal("runtime value key", runtime.eval<EAnyKey::EValue>(4), 8);
+    expect_equal("compile-time value key", compile_t::eval<ECompileKey::EValue>(4, 5), 405);
+    runtime.execute<EAnyKey::EEvent>(1);
+    compile_t::execute<ECompileKey::EEvent>(2, 3);
+    expect_equal("compile-time runtime key", compile_t::execute(ECompileKey::EEvent, 4, 5), 1);
+    expect_calls("events of both enumerators", calls, {1, 203, 405});
+
+    //Detaching the key of one enumerator leaves the equal key of the other one attached
+    runtime.detach<EAnyKey::EValue>();
+    expect_equal("compile-time key after runtime detach", compile_t::eval<ECompileKey::EValue>(1, 2), 102);
+    compile_t::detach<ECompileKey::EEvent>();
+    runtime.execute<EAnyKey::EEvent>(7);
+    expect_calls("runtime key after compile-time detach", calls, {1, 203, 405, 7});
+}
+
+int main()
+{
+    test_reattach();
+    test_reattach_void();
+    test_equal_values();
+
+    return finish("any");
+}
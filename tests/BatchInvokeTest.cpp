@@ -0,0 +1,127 @@
+#include <functional>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "EasyDelegate.hpp"
+#include "TestHarness.hpp"
+
+using namespace EasyDelegate;
+using namespace EasyDelegateTest;
+
+// Calls TTypedDelegate::invoke_batch over argument rows and invoke_batch_soa over argument columns and checks every result,
+// that a null result array still calls the delegate once per element, that batches stay correct after rebinding
+// to another callable type, including std::function objects that take the generic loop, and void signatures.
+
+namespace
+{
+    int add(int x, int y)
+    {
+        return x + y;
+    }
+
+    struct FScale
+    {
+        int scale(int x, int y) { return x * y * factor; }
+
+        int factor{2};
+    };
+}
+
+void test_rows()
+{
+    TTypedDelegate<int(int, int)> typed(&add);
+    std::vector<std::tuple<int, int>> rows{{1, 2}, {3, 4}, {-5, 5}, {10, 20}};
+    std::vector<int> results(rows.size(), -1);
+    typed.invoke_batch(rows.data(), rows.size(), results.data());
+    expect_calls("row results", results, {3, 7, 0, 30});
+
+    //Empty batch leaves the results untouched
+    typed.invoke_batch(rows.data(), 0, results.data());
+    expect_calls("empty batch", results, {3, 7, 0, 30});
+}
+
+void test_columns()
+{
+    FScale scale;
+    TTypedDelegate<int(int, int)> typed(&scale, &FScale::scale);
+    std::vector<int> xs{1, 2, 3, 4, 5};
+    std::vector<int> ys{5, 4, 3, 2, 1};
+    std::vector<int> results(xs.size(), -1);
+    typed.invoke_batch_soa(xs.size(), results.data(), xs.data(), ys.data());
+    expect_calls("column results", results, {10, 16, 18, 16, 10});
+
+    //Method sees the current state of the object
+    scale.factor = 1;
+    typed.invoke_batch_soa(xs.size(), results.data(), xs.data(), ys.data());
+    expect_calls("column results after state change", results, {5, 8, 9, 8, 5});
+}
+
+void test_null_results()
+{
+    int calls{0};
+    TTypedDelegate<int(int, int)> typed([&calls](int x, int y) { ++calls; return x + y; });
+    std::vector<std::tuple<int, int>> rows{{1, 2}, {3, 4}, {5, 6}};
+    typed.invoke_batch(rows.data(), rows.size());
+    expect_equal("rows without results", calls, 3);
+
+    std::vector<int> xs{1, 2};
+    std::vector<int> ys{3, 4};
+    typed.invoke_batch_soa(xs.size(), nullptr, xs.data(), ys.data());
+    expect_equal("columns without results", calls, 5);
+}
+
+void test_rebinding()
+{
+    TTypedDelegate<int(int, int)> typed([](int x, int y) { return x - y; });
+    std::vector<std::tuple<int, int>> rows{{5, 1}, {7, 3}};
+    std::vector<int> xs{5, 7};
+    std::vector<int> ys{1, 3};
+    std::vector<int> results(rows.size(), 0);
+    typed.invoke_batch(rows.data(), rows.size(), results.data());
+    expect_calls("first lambda", results, {4, 4});
+
+    //Another lambda type is bound to its own loop
+    typed.attach([](int x, int y) { return x * y; });
+    typed.invoke_batch(rows.data(), rows.size(), results.data());
+    expect_calls("second lambda", results, {5, 21});
+
+    //std::function hides the callable type, the batch takes the generic loop
+    typed.attach(std::function<int(int, int)>([](int x, int y) { return x + y * 10; }));
+    typed.invoke_batch(rows.data(), rows.size(), results.data());
+    expect_calls("std::function fallback rows", results, {15, 37});
+    typed.invoke_batch_soa(xs.size(), results.data(), xs.data(), ys.data());
+    expect_calls("std::function fallback columns", results, {15, 37});
+
+    typed.attach(&add);
+    typed.invoke_batch(rows.data(), rows.size(), results.data());
+    expect_calls("function after fallback", results, {6, 10});
+}
+
+void test_void()
+{
+    std::vector<int> received;
+    TTypedDelegate<void(int)> typed([&received](int x) { received.push_back(x); });
+    std::vector<std::tuple<int>> rows{{1}, {2}, {3}};
+    typed.invoke_batch(rows.data(), rows.size());
+    std::vector<int> column{4, 5};
+    typed.invoke_batch_soa(column.size(), nullptr, column.data());
+    expect_calls("void batches", received, {1, 2, 3, 4, 5});
+
+    //Const reference arguments are passed from the stored values
+    int length{0};
+    TTypedDelegate<void(const std::string&)> measure([&length](const std::string& text) { length += static_cast<int>(text.size()); });
+    std::vector<std::tuple<std::string>> words{{"one"}, {"three"}};
+    measure.invoke_batch(words.data(), words.size());
+    expect_equal("const reference rows", length, 8);
+}
+
+int main()
+{
+    test_rows();
+    test_columns();
+    test_null_results();
+    test_rebinding();
+    test_void();
+
+    return finish("batch invoke");
+}
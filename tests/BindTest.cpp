@@ -0,0 +1,129 @@
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "EasyDelegate.hpp"
+#include "TestHarness.hpp"
+
+using namespace EasyDelegate;
+using namespace EasyDelegateTest;
+
+// Binds values with bind_front and bind_back and reorders arguments with reorder, then checks the order in which
+// the callable receives them, that rvalues used once are forwarded and that bound values are stored flat
+// and trivially copyable, so delegates keep them in the small buffer.
+
+namespace
+{
+    //Records the arguments in the order of receiving
+    std::vector<int> record(int a, int b, int c)
+    {
+        return {a, b, c};
+    }
+
+    int subtract(int x, int y)
+    {
+        return x - y;
+    }
+
+    struct FAccount
+    {
+        int deposit(int amount, int bonus)
+        {
+            balance += amount + bonus;
+            return balance;
+        }
+
+        int balance{0};
+    };
+
+    struct FBoundValues
+    {
+        FAccount* object;
+        int amount;
+    };
+
+    struct FEmpty
+    {
+        int operator()(int x) const { return x; }
+    };
+}
+
+void test_bound_order()
+{
+    expect_calls("bind_front", bind_front(&record, 1, 2)(3), {1, 2, 3});
+    expect_calls("bind_back", bind_back(&record, 2, 3)(1), {1, 2, 3});
+    expect_calls("bind_front<function>", bind_front<&record>(1)(2, 3), {1, 2, 3});
+    expect_calls("bind_back<function>", bind_back<&record>(3)(1, 2), {1, 2, 3});
+    expect_equal("bind_front subtract", bind_front(&subtract, 10)(3), 7);
+    expect_equal("bind_back subtract", bind_back(&subtract, 10)(3), -7);
+
+    //Object pointer goes first for methods
+    FAccount account;
+    auto deposit = bind_front<&FAccount::deposit>(&account, 100);
+    expect_equal("bound method", deposit(5), 105);
+    expect_equal("bound method object", account.balance, 105);
+    expect_equal("bind_back method", bind_back(&FAccount::deposit, 1)(&account, 4), 110);
+
+    //Bound values are copies, the binder keeps its own state
+    int counter{0};
+    auto count = bind_front([](int& value, int step) { value += step; return value; }, counter);
+    count(2);
+    expect_equal("bound value mutated in the binder", count(3), 5);
+    expect_equal("original value untouched", counter, 0);
+}
+
+void test_reorder()
+{
+    expect_calls("reorder swap", reorder<2, 0, 1>(&record)(1, 2, 3), {3, 1, 2});
+    expect_equal("reorder subtract", reorder<1, 0>(&subtract)(3, 10), 7);
+    expect_calls("reorder repeated", reorder<0, 0, 1>(&record)(4, 5), {4, 4, 5});
+    expect_equal("reorder dropped", reorder<1>([](int x) { return x; })(8, 9), 9);
+
+    //Argument used once is forwarded, a repeated one is passed as lvalue
+    std::string moved;
+    auto take = reorder<1, 0>([&moved](std::string text, int) { moved = std::move(text); });
+    std::string source("payload");
+    take(1, std::move(source));
+    expect_equal("forwarded once", moved == "payload" && source.empty(), true);
+
+    std::vector<std::string> copies;
+    auto both = reorder<0, 0>([&copies](const std::string& first, std::string second) { copies = {first, second}; });
+    std::string shared("shared");
+    both(std::move(shared));
+    expect_equal("repeated not moved from", copies.size() == 2 && copies[0] == "shared" && copies[1] == "shared" && shared == "shared", true);
+
+    //Move-only values survive the reorder
+    auto unique = reorder<1, 0>([](std::unique_ptr<int> value, int offset) { return *value + offset; });
+    expect_equal("move-only argument", unique(1, std::make_unique<int>(41)), 42);
+}
+
+void test_inline_storage()
+{
+    //Compile-time functions and empty callables take no space, only the values are stored
+    static_assert(sizeof(bind_front<&FAccount::deposit>(static_cast<FAccount*>(nullptr), 1)) == sizeof(FBoundValues), "Only the bound values should be stored.");
+    static_assert(sizeof(bind_back<&subtract>(1)) == sizeof(int), "Only the bound value should be stored.");
+    static_assert(sizeof(bind_front(FEmpty{}, 1)) == sizeof(int), "Empty callable should take no space.");
+    static_assert(sizeof(reorder<1, 0>(&subtract)) == sizeof(&subtract), "Reorder should store only the callable.");
+    static_assert(std::is_trivially_copyable<decltype(bind_front<&FAccount::deposit>(static_cast<FAccount*>(nullptr), 1))>::value, "Bound values should stay trivially copyable.");
+    static_assert(std::is_trivially_copyable<decltype(bind_back(&subtract, 1))>::value, "Bound values should stay trivially copyable.");
+
+    FAccount account;
+    TDelegate<int(int)> deposit;
+    deposit.attach<&FAccount::deposit>(&account, 10);
+    expect_equal("attach<method> with values", deposit(1), 11);
+
+    TDelegate<int(int, int)> swapped(reorder<1, 0>(&subtract));
+    expect_equal("attached reorder", swapped(1, 10), 9);
+
+    TDelegate<int(int)> back(bind_back<&subtract>(100));
+    expect_equal("attached bind_back", back(1), -99);
+}
+
+int main()
+{
+    test_bound_order();
+    test_reorder();
+    test_inline_storage();
+
+    return finish("bind");
+}
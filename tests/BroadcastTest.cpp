@@ -0,0 +1,169 @@
+#include <array>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include "EasyDelegate.hpp"
+#include "TestHarness.hpp"
+
+using namespace EasyDelegate;
+using namespace EasyDelegateTest;
+
+// Fans out arguments to several handlers of TDelegateMulti and checks that every handler sees the original value, 
+// rvalues are never moved from before the last handler and large messages are not copied by the container.
+
+namespace
+{
+
+    int g_Copies{0};
+    int g_Moves{0};
+
+    //Large message counting its copies and moves
+    struct FMessage
+    {
+        FMessage() = default;
+        FMessage(const FMessage& other) : payload(other.payload) { ++g_Copies; }
+        FMessage(FMessage&& other) noexcept : payload(other.payload) { other.payload.fill(0); ++g_Moves; }
+        FMessage& operator=(const FMessage&) = default;
+        FMessage& operator=(FMessage&&) = default;
+
+        std::array<int, 256> payload{};
+    };
+
+    void reset_counters()
+    {
+        g_Copies = 0;
+        g_Moves = 0;
+    }
+}
+
+enum class EHandler
+{
+    EFirst,
+    ESecond,
+    EThird,
+    EFourth
+};
+
+void test_large_by_reference()
+{
+    TDelegateMulti<EHandler, void(const FMessage&)> multi;
+    int seen{0};
+    auto handler = [&seen](const FMessage& message) { seen += message.payload[255]; };
+    multi.attach<EHandler::EFirst>(handler);
+    multi.attach<EHandler::ESecond>(handler);
+    multi.attach<EHandler::EThird>(handler);
+    multi.attach<EHandler::EFourth>(handler);
+
+    FMessage message;
+    message.payload[255] = 1;
+    reset_counters();
+    multi.execute(std::move(message));
+    expect_equal("large by reference copies", g_Copies, 0);
+    expect_equal("large by reference moves", g_Moves, 0);
+    expect_equal("large by reference seen", seen, 4);
+}
+
+void test_large_by_value()
+{
+    TDelegateMulti<EHandler, void(FMessage)> multi;
+    int seen{0};
+    auto handler = [&seen](FMessage message) { seen += message.payload[255]; };
+    multi.attach<EHandler::EFirst>(handler);
+    multi.attach<EHandler::ESecond>(handler);
+    multi.attach<EHandler::EThird>(handler);
+
+    //Every handler copies the shared message, none of them sees a moved-from one
+    FMessage message;
+    message.payload[255] = 1;
+    reset_counters();
+    multi.execute(std::move(message));
+    expect_equal("large by value copies", g_Copies, 3);
+    expect_equal("large by value seen", seen, 3);
+    expect_equal("large by value source", message.payload[255], 1);
+
+    //The last handler takes the message
+    seen = 0;
+    reset_counters();
+    multi.execute<TBroadcastForwardLast>(std::move(message));
+    expect_equal("forward last copies", g_Copies, 2);
+    expect_equal("forward last seen", seen, 3);
+    expect_equal("forward last source", message.payload[255], 0);
+}
+
+void test_move_only()
+{
+    TDelegateMulti<EHandler, void(const std::unique_ptr<int>&)> multi;
+    int seen{0};
+    auto handler = [&seen](const std::unique_ptr<int>& value) { seen += value ? *value : 0; };
+    multi.attach<EHandler::EFirst>(handler);
+    multi.attach<EHandler::ESecond>(handler);
+    multi.attach<EHandler::EThird>(handler);
+    multi.execute(std::make_unique<int>(2));
+    expect_equal("move only seen", seen, 6);
+
+    //Single handler by value takes the ownership
+    TDelegateMulti<EHandler, void(std::unique_ptr<int>)> sink;
+    std::unique_ptr<int> owned;
+    sink.attach<EHandler::EFirst>([&owned](std::unique_ptr<int> value) { owned = std::move(value); });
+    auto value = std::make_unique<int>(7);
+    sink.execute<TBroadcastForwardLast>(std::move(value));
+    expect_equal("move only owned", owned ? *owned : 0, 7);
+    expect_equal("move only source", value == nullptr, 1);
+
+    //Second handler would get a moved-from value, the call is rejected before any handler runs
+    int calls{0};
+    sink.attach<EHandler::ESecond>([&calls](std::unique_ptr<int>) { ++calls; });
+    sink.attach<EHandler::EFirst>([&calls](std::unique_ptr<int>) { ++calls; });
+    bool bThrown{false};
+    try
+    {
+        sink.execute<TBroadcastForwardLast>(std::make_unique<int>(8));
+    }
+    catch (const std::logic_error&)
+    {
+        bThrown = true;
+    }
+    expect_equal("move only several handlers thrown", bThrown, 1);
+    expect_equal("move only several handlers calls", calls, 0);
+
+    sink.execute<TBroadcastForwardLast>(key_mask<EHandler::ESecond>(), std::make_unique<int>(9));
+    expect_equal("move only masked to single handler", calls, 1);
+}
+
+void test_eval()
+{
+    TDelegateMulti<EHandler, std::size_t(std::string)> multi;
+    multi.attach<EHandler::EFirst>([](std::string value) { return value.size(); });
+    multi.attach<EHandler::ESecond>([](std::string value) { std::string taken(std::move(value)); return taken.size(); });
+    multi.attach<EHandler::EThird>([](std::string value) { return value.size(); });
+
+    auto results = multi.eval(std::string(64, 'x'));
+    expect_equal("eval first", results[EHandler::EFirst], 64);
+    expect_equal("eval second", results[EHandler::ESecond], 64);
+    expect_equal("eval third", results[EHandler::EThird], 64);
+
+    auto forwarded = multi.eval<TBroadcastForwardLast>(std::string(64, 'x'));
+    expect_equal("eval forward last", forwarded[EHandler::EThird], 64);
+}
+
+void test_lvalue_reference()
+{
+    //Lvalue arguments keep their type, handlers can accumulate into them
+    TDelegateMulti<EHandler, void(int&)> multi;
+    multi.attach<EHandler::EFirst>([](int& value) { value += 1; });
+    multi.attach<EHandler::ESecond>([](int& value) { value *= 10; });
+    int value{1};
+    multi.execute(value);
+    expect_equal("lvalue reference", value, 20);
+}
+
+int main()
+{
+    test_large_by_reference();
+    test_large_by_value();
+    test_move_only();
+    test_eval();
+    test_lvalue_reference();
+
+    return finish("broadcast");
+}
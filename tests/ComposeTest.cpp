@@ -0,0 +1,120 @@
+#include <string>
+#include <vector>
+#include "EasyDelegate.hpp"
+#include "TestHarness.hpp"
+
+using namespace EasyDelegate;
+using namespace EasyDelegateTest;
+
+// Fuses stages with pipe, compose and operator| and checks the order in which they are called, that a void stage
+// makes the next stage called without arguments and that pipelines attached to delegates give the same results.
+
+namespace
+{
+    std::vector<int> g_Calls;
+
+    int add_one(int x)
+    {
+        g_Calls.push_back(1);
+        return x + 1;
+    }
+
+    int twice(int x)
+    {
+        g_Calls.push_back(2);
+        return x * 2;
+    }
+
+    int square(int x)
+    {
+        g_Calls.push_back(3);
+        return x * x;
+    }
+
+    struct FCounter
+    {
+        int add(int x)
+        {
+            total += x;
+            return total;
+        }
+
+        int total{0};
+    };
+}
+
+enum class EStage
+{
+    EConvert,
+    EReport
+};
+
+void test_order()
+{
+    g_Calls.clear();
+    expect_equal("pipe result", pipe(&add_one, &twice, &square)(2), 36);
+    expect_calls("pipe calls left to right", g_Calls, {1, 2, 3});
+
+    g_Calls.clear();
+    expect_equal("compose result", compose(&add_one, &twice, &square)(2), 9);
+    expect_calls("compose calls right to left", g_Calls, {3, 2, 1});
+
+    g_Calls.clear();
+    auto piped = pipe(stage<&add_one>()) | stage<&twice>() | [](int x) { g_Calls.push_back(4); return x - 1; };
+    expect_equal("operator| result", piped(3), 7);
+    expect_calls("operator| appends", g_Calls, {1, 2, 4});
+
+    //Compile-time stages add no storage
+    static_assert(sizeof(pipe(stage<&add_one>(), stage<&twice>())) == 1, "Compile-time stages should be empty.");
+    constexpr auto constant = pipe([](int x) { return x + 1; }, [](int x) { return x * 3; })(1);
+    static_assert(constant == 6, "Pipelines of constexpr stages should be evaluated at compile time.");
+
+    //Method stage takes the object as the first argument
+    FCounter counter;
+    expect_equal("method stage", pipe(stage<&FCounter::add>(), stage<&twice>())(&counter, 5), 10);
+    expect_equal("method stage object", counter.total, 5);
+}
+
+void test_void_stages()
+{
+    g_Calls.clear();
+    std::vector<int> seen;
+    auto report = pipe([&seen](int x) { seen.push_back(x); }, []() { g_Calls.push_back(5); return 42; });
+    expect_equal("stage after void stage", report(7), 42);
+    expect_calls("void stage received the argument", seen, {7});
+    expect_calls("next stage called without arguments", g_Calls, {5});
+
+    int last{0};
+    auto sink = pipe(&twice, [&last](int x) { last = x; });
+    sink(4);
+    expect_equal("void last stage", last, 8);
+}
+
+void test_attached()
+{
+    TDelegate<int(int)> convert(pipe(stage<&add_one>(), stage<&square>()));
+    expect_equal("TDelegate pipeline", convert(3), 16);
+
+    convert.attach(compose(stage<&add_one>(), stage<&square>()));
+    expect_equal("TDelegate composition", convert(3), 10);
+
+    TDelegateMulti<EStage, int(int)> stages;
+    stages.attach<EStage::EConvert>(pipe(stage<&twice>(), stage<&add_one>()));
+    stages.attach<EStage::EReport>(compose(stage<&twice>(), stage<&add_one>()));
+    expect_equal("TDelegateMulti pipeline", stages.eval<EStage::EConvert>(5), 11);
+    expect_equal("TDelegateMulti composition", stages.eval<EStage::EReport>(5), 12);
+
+    std::string log;
+    TDelegate<void(const std::string&)> print(pipe([](const std::string& text) { return text + "!"; }, [&log](const std::string& text) { log += text; }));
+    print("done");
+    expect_equal("pipeline with references", log == "done!", true);
+}
+
+int main()
+{
+    test_order();
+    test_void_stages();
+    test_attached();
+
+    return finish("compose");
+}
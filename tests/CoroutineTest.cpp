@@ -0,0 +1,284 @@
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "EasyDelegateCoroutineImpl.hpp"
+#include "TestHarness.hpp"
+
+using namespace EasyDelegate;
+using namespace EasyDelegateTest;
+
+// Awaits TAwaitableDelegateMulti::next from coroutines and checks that they are resumed only by the call of their key with
+// its arguments, that a coroutine can wait again from inside the resume without being resumed twice by one call,
+// that a destroyed frame unlinks its awaiter, that only calls of a waited key copy their arguments, that waiters stay 
+// with the moved-from container and that async_invoke delivers results and exceptions.
+
+enum class EEvent
+{
+    EOpen,
+    EData,
+    EClose
+};
+
+namespace
+{
+    //Coroutine that starts eagerly and keeps its frame after completion, so the test can destroy it at any point
+    struct FTask
+    {
+        struct promise_type
+        {
+            FTask get_return_object() noexcept { return FTask{std::coroutine_handle<promise_type>::from_promise(*this)}; }
+            std::suspend_never initial_suspend() noexcept { return {}; }
+            std::suspend_always final_suspend() noexcept { return {}; }
+            void return_void() noexcept {}
+            void unhandled_exception() { std::terminate(); }
+        };
+
+        FTask() noexcept = default;
+        explicit FTask(std::coroutine_handle<promise_type> handle) noexcept : m_Handle(handle) {}
+        FTask(FTask&& other) noexcept : m_Handle(std::exchange(other.m_Handle, {})) {}
+        FTask(const FTask&) = delete;
+
+        FTask& operator=(FTask&& other) noexcept
+        {
+            std::swap(m_Handle, other.m_Handle);
+            return *this;
+        }
+
+        ~FTask()
+        {
+            if (m_Handle)
+            {
+                m_Handle.destroy();
+            }
+        }
+
+        bool done() const noexcept
+        {
+            return m_Handle.done();
+        }
+
+        std::coroutine_handle<promise_type> m_Handle;
+    };
+
+    using events_t = TAwaitableDelegateMulti<EEvent, void(int, const std::string&)>;
+
+    FTask wait_open(events_t& events, int& id, std::string& name)
+    {
+        auto [value, text] = co_await events.next<EEvent::EOpen>();
+        id = value;
+        name = text;
+    }
+
+    //Waits again from inside every resume until the close call
+    FTask read_all(events_t& events, std::vector<int>& received)
+    {
+        for (;;)
+        {
+            auto [value, text] = co_await events.next<EEvent::EData>();
+            received.push_back(value);
+            if (text == "last")
+            {
+                break;
+            }
+        }
+    }
+
+    FTask wait_close(events_t& events, int& closed)
+    {
+        co_await events.next<EEvent::EClose>();
+        ++closed;
+    }
+
+    //Counts copies of the call argument
+    struct FCounted
+    {
+        FCounted() = default;
+        FCounted(const FCounted&) { ++copies; }
+
+        static inline int copies{0};
+    };
+
+    using counted_events_t = TAwaitableDelegateMulti<EEvent, void(const FCounted&)>;
+
+    FTask wait_counted(counted_events_t& events, bool& resumed)
+    {
+        co_await events.next<EEvent::EOpen>();
+        resumed = true;
+    }
+
+    FTask compute(TDelegateThreadPool& pool, TDelegate<int(int)>& _delegate, int argument, std::atomic<int>& result, std::atomic<bool>& failed)
+    {
+        try
+        {
+            result.store(co_await async_invoke(pool, _delegate, argument));
+        }
+        catch (const std::invalid_argument&)
+        {
+            failed.store(true);
+        }
+    }
+}
+
+void test_resume_on_key()
+{
+    events_t events;
+    std::vector<int> handled;
+    events.attach<EEvent::EOpen>([&handled](int value, const std::string&) { handled.push_back(value); });
+    events.attach<EEvent::EData>([](int, const std::string&) {});
+
+    int id{0};
+    std::string name;
+    FTask task = wait_open(events, id, name);
+    expect_equal("suspended until the call", task.done(), false);
+
+    events.execute<EEvent::EData>(1, std::string("data"));
+    expect_equal("other key does not resume", task.done(), false);
+
+    events.execute<EEvent::EOpen>(7, std::string("session"));
+    expect_equal("resumed by the key", task.done(), true);
+    expect_equal("resumed with the arguments", id, 7);
+    expect_equal("resumed with the string argument", name == "session", true);
+    expect_calls("attached handler still called", handled, {7});
+
+    //Nobody waits after the resume
+    events.execute<EEvent::EOpen>(8, std::string("again"));
+    expect_equal("awaiter resumed once", id, 7);
+}
+
+void test_resubscribe_inside_resume()
+{
+    events_t events;
+    std::vector<int> received;
+    FTask task = read_all(events, received);
+
+    //Execute of all keys calls only the attached ones
+    int handled{0};
+    events.attach<EEvent::EData>([&handled](int, const std::string&) { ++handled; });
+
+    events.execute<EEvent::EData>(1, std::string("first"));
+    expect_calls("single resume per call", received, {1});
+    events.execute(2, std::string("all keys"));
+    expect_calls("resume from execute of all keys", received, {1, 2});
+    events.execute<EEvent::EData>(3, std::string("last"));
+    expect_calls("every call delivered", received, {1, 2, 3});
+    expect_equal("loop finished", task.done(), true);
+
+    events.execute<EEvent::EData>(4, std::string("late"));
+    expect_calls("finished coroutine not resumed", received, {1, 2, 3});
+    expect_equal("attached handler called", handled, 4);
+}
+
+void test_destroyed_frame()
+{
+    events_t events;
+    int closed{0};
+    {
+        FTask first = wait_close(events, closed);
+        FTask second = wait_close(events, closed);
+        {
+            FTask destroyed = wait_close(events, closed);
+        }
+        events.execute<EEvent::EClose>(0, std::string());
+        expect_equal("living awaiters resumed", closed, 2);
+        expect_equal("first finished", first.done() && second.done(), true);
+    }
+
+    //Frames destroyed while waiting leave nothing behind in the container, the key has neither handler nor waiter
+    {
+        FTask abandoned = wait_close(events, closed);
+    }
+    bool thrown{false};
+    try
+    {
+        events.execute<EEvent::EClose>(0, std::string());
+    }
+    catch (const std::bad_function_call&)
+    {
+        thrown = true;
+    }
+    expect_equal("destroyed awaiter not resumed", closed, 2);
+    expect_equal("key without handler and waiter throws", thrown, true);
+}
+
+void test_copy_only_for_waited_key()
+{
+    counted_events_t events;
+    int handled{0};
+    events.attach<EEvent::EData>([&handled](const FCounted&) { ++handled; });
+    events.attach<EEvent::EOpen>([&handled](const FCounted&) { ++handled; });
+
+    bool resumed{false};
+    FTask task = wait_counted(events, resumed);
+    const FCounted argument;
+    events.execute<EEvent::EData>(argument);
+    expect_equal("other key does not copy the arguments", FCounted::copies, 0);
+    events.execute<EEvent::EOpen>(argument);
+    expect_equal("waited key resumes", resumed, true);
+    expect_equal("waited key copies the arguments", FCounted::copies > 0, true);
+    expect_equal("handlers called", handled, 2);
+
+    //Plain container has no waiter list
+    static_assert(sizeof(TDelegateMulti<EEvent, void(const FCounted&)>) < sizeof(counted_events_t), "TDelegateMulti should not carry the waiter list.");
+}
+
+void test_moved_container()
+{
+    events_t events;
+    int closed{0};
+    FTask task = wait_close(events, closed);
+
+    //Waiting coroutines stay with the original container
+    events_t moved(std::move(events));
+    moved.attach<EEvent::EClose>([](int, const std::string&) {});
+    moved.execute<EEvent::EClose>(0, std::string());
+    expect_equal("moved-to container has no waiters", closed, 0);
+    events.execute<EEvent::EClose>(0, std::string());
+    expect_equal("original container resumes", closed, 1);
+    expect_equal("resumed once", task.done(), true);
+}
+
+void test_async_invoke()
+{
+    TDelegate<int(int)> checked([](int x)
+    {
+        if (x < 0)
+        {
+            throw std::invalid_argument("negative");
+        }
+        return x * x;
+    });
+
+    std::atomic<int> result{0};
+    std::atomic<bool> failed{false};
+    {
+        FTask task;
+        FTask error;
+        {
+            //Coroutines continue on the workers, joining them leaves both frames at the final suspend
+            TDelegateThreadPool pool(2);
+            task = compute(pool, checked, 12, result, failed);
+            error = compute(pool, checked, -1, result, failed);
+        }
+        expect_equal("async finished", task.done() && error.done(), true);
+        expect_equal("async result", result.load(), 144);
+        expect_equal("async exception", failed.load(), true);
+    }
+}
+
+int main()
+{
+    test_resume_on_key();
+    test_resubscribe_inside_resume();
+    test_destroyed_frame();
+    test_copy_only_for_waited_key();
+    test_moved_container();
+    test_async_invoke();
+
+    return finish("coroutine");
+}
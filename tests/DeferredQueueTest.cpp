@@ -0,0 +1,135 @@
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "EasyDelegate.hpp"
+#include "TestHarness.hpp"
+
+using namespace EasyDelegate;
+using namespace EasyDelegateTest;
+
+// Queues calls into TDelegateDeferredQueue and checks that they are invoked in order across the wrap of the ring buffer, 
+// that every stored argument is destroyed exactly once and that a throwing delegate does not stall the queue.
+
+namespace
+{
+    int g_Alive{0};
+
+    //Argument counting its living copies
+    struct FTracked
+    {
+        explicit FTracked(int v) : value(v) { ++g_Alive; }
+        FTracked(const FTracked& other) : value(other.value) { ++g_Alive; }
+        FTracked(FTracked&& other) noexcept : value(other.value) { ++g_Alive; }
+        ~FTracked() { --g_Alive; }
+
+        int value;
+    };
+}
+
+void test_order_and_wrap()
+{
+    std::vector<int> calls;
+    TDelegate<void(int)> record([&calls](int x) { calls.push_back(x); });
+    TDelegateDeferredQueue<1024> queue;
+
+    std::vector<int> expected;
+    for (int round = 0; round < 20; ++round)
+    {
+        for (int i = 0; i < 7; ++i)
+        {
+            expect_equal("enqueue", queue.enqueue(record, round * 10 + i), true);
+            expected.push_back(round * 10 + i);
+        }
+        expect_equal("flush count", static_cast<long long>(queue.flush()), 7);
+    }
+    expect_calls("order across wrap", calls, expected);
+    expect_equal("empty after flush", queue.empty(), true);
+
+    std::size_t queued{0};
+    while (queue.enqueue(record, 1))
+    {
+        ++queued;
+    }
+    expect_equal("full queue rejects", queued > 0 && queue.size() <= queue.capacity(), true);
+    queue.clear();
+    expect_equal("empty after clear", queue.empty(), true);
+}
+
+void test_argument_lifetime()
+{
+    int sum{0};
+    TDelegate<void(const FTracked&)> read([&sum](const FTracked& tracked) { sum += tracked.value; });
+    {
+        TDelegateDeferredQueue<1024> queue;
+        queue.enqueue(read, FTracked(1));
+        queue.enqueue(read, FTracked(2));
+        expect_equal("queued arguments alive", g_Alive, 2);
+        queue.flush();
+        expect_equal("flushed arguments destroyed", g_Alive, 0);
+
+        queue.enqueue(read, FTracked(3));
+        queue.clear();
+        expect_equal("cleared arguments destroyed", g_Alive, 0);
+
+        queue.enqueue(read, FTracked(4));
+    }
+    expect_equal("arguments destroyed with the queue", g_Alive, 0);
+    expect_equal("flushed values", sum, 3);
+}
+
+void test_throwing_delegate()
+{
+    std::vector<int> calls;
+    TDelegate<void(const FTracked&)> record([&calls](const FTracked& tracked) 
+    { 
+        if (tracked.value < 0)
+        {
+            throw std::runtime_error("negative");
+        }
+        calls.push_back(tracked.value); 
+    });
+
+    TDelegateDeferredQueue<256> queue;
+    queue.enqueue(record, FTracked(1));
+    queue.enqueue(record, FTracked(-1));
+    queue.enqueue(record, FTracked(2));
+
+    bool thrown{false};
+    try
+    {
+        queue.flush();
+    }
+    catch (const std::runtime_error&)
+    {
+        thrown = true;
+    }
+    expect_equal("exception propagated", thrown, true);
+    expect_equal("throwing call destroyed", g_Alive, 1);
+    expect_equal("remaining flushed", static_cast<long long>(queue.flush()), 1);
+    expect_calls("calls around exception", calls, {1, 2});
+    expect_equal("all destroyed", g_Alive, 0);
+
+    //The space of the throwing call is reused, so the queue does not fill up
+    for (int i = 0; i < 100; ++i)
+    {
+        expect_equal("enqueue after exceptions", queue.enqueue(record, FTracked(-1)), true);
+        try
+        {
+            queue.flush();
+        }
+        catch (const std::runtime_error&)
+        {
+        }
+    }
+    expect_equal("empty after exceptions", queue.empty(), true);
+}
+
+int main()
+{
+    test_order_and_wrap();
+    test_argument_lifetime();
+    test_throwing_delegate();
+
+    return finish("deferred queue");
+}
@@ -0,0 +1,151 @@
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "EasyDelegate.hpp"
+#include "TestHarness.hpp"
+
+using namespace EasyDelegate;
+using namespace EasyDelegateTest;
+
+// Freezes TDelegateMulti and checks that the snapshot calls the same delegates in the same order, ignores later changes 
+// of the container and can be called from several threads at once.
+
+enum class EKey : uint32_t
+{
+    EFirst,
+    ESecond,
+    EThird,
+    EFar = 200
+};
+
+void test_snapshot()
+{
+    std::vector<int> calls;
+    TDelegateMulti<EKey, void(int)> multi;
+    multi.attach<EKey::EFar>([&calls](int value) { calls.push_back(value * 1000); });
+    multi.attach<EKey::EFirst>([&calls](int value) { calls.push_back(value); });
+    multi.attach<EKey::ESecond>([&calls](int value) { calls.push_back(value * 10); });
+    multi.attach<EKey::EThird>([&calls](int value) { calls.push_back(value * 100); });
+    multi.disable<EKey::ESecond>();
+
+    const auto frozen = multi.freeze();
+    expect_equal("frozen size", frozen.size(), 3);
+    expect_equal("muted key not frozen", frozen.contains<EKey::ESecond>(), 0);
+
+    //Later changes of the container don't affect the snapshot
+    multi.detach<EKey::EFirst>();
+    multi.enable<EKey::ESecond>();
+    frozen.execute(1);
+    expect_equal("frozen calls", calls.size(), 3);
+    expect_equal("frozen order", calls.size() == 3 && calls[0] == 1 && calls[1] == 100 && calls[2] == 1000, 1);
+
+    calls.clear();
+    frozen.execute<EKey::EFar>(2);
+    frozen.execute<EKey::ESecond>(2);
+    frozen.execute(key_mask<EKey::EThird, EKey::ESecond>(), 3);
+    expect_equal("frozen key and mask", calls.size() == 2 && calls[0] == 2000 && calls[1] == 300, 1);
+}
+
+void test_eval()
+{
+    TDelegateMulti<EKey, int(std::unique_ptr<int>&&)> multi;
+    multi.attach<EKey::EFirst>([](std::unique_ptr<int>&& value) { return *value; });
+    const auto frozen = multi.freeze();
+    expect_equal("frozen eval key", frozen.eval<EKey::EFirst>(std::make_unique<int>(5)), 5);
+
+    //Move-only argument goes to the single handler
+    auto results = frozen.eval<TBroadcastForwardLast>(std::make_unique<int>(6));
+    expect_equal("frozen eval forward", results[EKey::EFirst], 6);
+
+    bool bThrown{false};
+    try
+    {
+        frozen.eval<EKey::EThird>(std::make_unique<int>(7));
+    }
+    catch (const std::bad_function_call&)
+    {
+        bThrown = true;
+    }
+    expect_equal("frozen eval missing key", bThrown, 1);
+
+    //Several handlers can't share a move-only argument
+    multi.attach<EKey::ESecond>([](std::unique_ptr<int>&& value) { return *value; });
+    const auto shared = multi.freeze();
+    bThrown = false;
+    try
+    {
+        shared.eval<TBroadcastForwardLast>(std::make_unique<int>(8));
+    }
+    catch (const std::logic_error&)
+    {
+        bThrown = true;
+    }
+    expect_equal("frozen eval several handlers", bThrown, 1);
+    auto single = shared.eval<TBroadcastForwardLast>(key_mask<EKey::ESecond>(), std::make_unique<int>(9));
+    expect_equal("frozen eval masked to single handler", single[EKey::ESecond], 9);
+}
+
+//Orders the keys from the last to the first
+struct FReverseComp
+{
+    bool operator()(EKey left, EKey right) const
+    {
+        return static_cast<uint32_t>(left) > static_cast<uint32_t>(right);
+    }
+};
+
+void test_comparator()
+{
+    TDelegateMulti<EKey, int(int), FReverseComp> multi;
+    multi.attach<EKey::EFirst>([](int value) { return value; });
+    multi.attach<EKey::EThird>([](int value) { return value * 3; });
+    multi.attach<EKey::EFar>([](int value) { return value * 200; });
+
+    //Results keep the comparator of the container
+    const auto frozen = multi.freeze();
+    std::vector<int> results;
+    for (const auto& [_key, _result] : frozen.eval(1))
+    {
+        results.push_back(_result);
+    }
+    expect_calls("frozen eval comparator", results, {200, 3, 1});
+}
+
+void test_threads()
+{
+    std::atomic<long long> sum{0};
+    TDelegateMulti<EKey, void(int)> multi;
+    multi.attach<EKey::EFirst>([&sum](int value) { sum.fetch_add(value, std::memory_order_relaxed); });
+    multi.attach<EKey::EFar>([&sum](int value) { sum.fetch_add(value * 2, std::memory_order_relaxed); });
+    const auto frozen = multi.freeze();
+
+    constexpr int threads = 4, iterations = 10000;
+    std::vector<std::thread> workers;
+    for (int thread = 0; thread < threads; ++thread)
+    {
+        workers.emplace_back([&frozen]
+        {
+            for (int i = 0; i < iterations; ++i)
+            {
+                frozen.execute(1);
+            }
+        });
+    }
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+    expect_equal("frozen threads", sum.load(), 3LL * threads * iterations);
+}
+
+int main()
+{
+    test_snapshot();
+    test_eval();
+    test_comparator();
+    test_threads();
+
+    return finish("frozen multi");
+}
@@ -0,0 +1,231 @@
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "EasyDelegate.hpp"
+#include "TestHarness.hpp"
+
+using namespace EasyDelegate;
+using namespace EasyDelegateTest;
+
+// Rebinds global delegates between static functions, inline callables and heap records while they are called, 
+// including handlers that detach or rebind their own delegate or each other's from different threads, 
+// which must neither hang nor lose the binding.
+
+namespace
+{
+    int twice(int x)
+    {
+        return x * 2;
+    }
+
+    int thrice(int x)
+    {
+        return x * 3;
+    }
+
+    struct FScale
+    {
+        int scale(int x) const { return x * factor; }
+
+        int factor{5};
+    };
+
+    TDelegateGlobal<int(int)> g_Delegate;
+    TDelegateGlobal<void(int)> g_Handler;
+    TDelegateGlobal<void()> g_Ping;
+    TDelegateGlobal<void(int)> g_Pong;
+    std::atomic<int> g_Arrived{0};
+
+    //Heap record waiting until both handlers run, then replacing the heap record of the other delegate
+    template<class _Delegate>
+    void rebind_other(_Delegate& other)
+    {
+        std::array<int, 32> large{};
+        g_Arrived.fetch_add(1);
+        while (g_Arrived.load() < 2)
+        {
+            std::this_thread::yield();
+        }
+        other.attach([large](auto...) { g_Arrived.fetch_add(10 + large[0]); });
+    }
+}
+
+void test_kinds()
+{
+    FScale scale;
+    std::array<int, 32> large{};
+    large[0] = 7;
+
+    g_Delegate.attach<&twice>();
+    expect_equal("static function", g_Delegate(1), 2);
+    g_Delegate.attach(&thrice);
+    expect_equal("function pointer", g_Delegate(1), 3);
+    g_Delegate.attach(&scale, &FScale::scale);
+    expect_equal("const method", g_Delegate(1), 5);
+    g_Delegate.attach([offset = 10](int x) { return x + offset; });
+    expect_equal("small lambda", g_Delegate(1), 11);
+    g_Delegate.attach([large](int x) { return x + large[0]; });
+    expect_equal("large lambda", g_Delegate(1), 8);
+    g_Delegate.attach(&thrice);
+    expect_equal("heap record replaced by inline", g_Delegate(2), 6);
+    g_Delegate.detach();
+    expect_equal("detached", static_cast<bool>(g_Delegate), false);
+}
+
+void test_self_rebind()
+{
+    std::vector<int> calls;
+    std::array<int, 32> large{};
+
+    //Heap record detaching itself from its own handler, released when the call returns
+    g_Handler.attach([&calls, large](int x) { calls.push_back(x + large[0]); g_Handler.detach(); });
+    expect_equal("self detach called", g_Handler.try_invoke(1), true);
+    expect_equal("self detach detached", g_Handler.try_invoke(2), false);
+
+    //Heap record replacing itself with another heap record, twice in the same call
+    g_Handler.attach([&calls, large](int x) 
+    { 
+        calls.push_back(x + large[0]); 
+        g_Handler.attach([&calls, large](int y) { calls.push_back(-y - large[0]); });
+        g_Handler.attach([&calls, large](int y) { calls.push_back(y * 10 + large[0]); }); 
+    });
+    g_Handler.try_invoke(3);
+    g_Handler.try_invoke(4);
+
+    //Inline callable rebinding itself
+    g_Handler.attach([&calls](int x) { calls.push_back(x); g_Handler.attach([&calls](int y) { calls.push_back(y + 100); }); });
+    g_Handler.try_invoke(5);
+    g_Handler.try_invoke(6);
+
+    expect_calls("self rebind", calls, {1, 3, 40, 5, 106});
+    g_Handler.detach();
+}
+
+void test_concurrent_rebind()
+{
+    std::atomic<bool> running{true};
+    std::atomic<long long> wrong{0};
+    std::array<int, 32> large{};
+
+    g_Delegate.attach<&twice>();
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 3; ++i)
+    {
+        readers.emplace_back([&]
+        {
+            while (running.load())
+            {
+                const int result = g_Delegate(1);
+                if (result != 2 && result != 3 && result != 5)
+                {
+                    wrong.fetch_add(1);
+                }
+            }
+        });
+    }
+
+    FScale scale;
+    for (int i = 0; i < 20000; ++i)
+    {
+        switch (i % 4)
+        {
+        case 0: g_Delegate.attach<&twice>(); break;
+        case 1: g_Delegate.attach(&thrice); break;
+        case 2: g_Delegate.attach(&scale, &FScale::scale); break;
+        default: g_Delegate.attach([large](int x) { return x * 3 + large[0]; }); break;
+        }
+    }
+
+    running.store(false);
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+    expect_equal("concurrent rebind results", wrong.load(), 0);
+    g_Delegate.detach();
+}
+
+void test_concurrent_writers()
+{
+    //Several writers replacing heap records at once must not release a record that a reader still calls
+    std::atomic<bool> running{true};
+    std::atomic<long long> wrong{0};
+
+    g_Delegate.attach([large = std::array<int, 32>{}](int x) { return x * 2 + large[31]; });
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 2; ++i)
+    {
+        threads.emplace_back([&]
+        {
+            while (running.load())
+            {
+                const int result = g_Delegate(1);
+                if (result != 2 && result != 3)
+                {
+                    wrong.fetch_add(1);
+                }
+            }
+        });
+    }
+
+    std::vector<std::thread> writers;
+    for (int i = 0; i < 3; ++i)
+    {
+        writers.emplace_back([i]
+        {
+            std::array<int, 32> large{};
+            for (int j = 0; j < 5000; ++j)
+            {
+                if ((i + j) % 2 == 0)
+                {
+                    g_Delegate.attach([large](int x) { return x * 2 + large[31]; });
+                }
+                else
+                {
+                    g_Delegate.attach([large](int x) { return x * 3 + large[31]; });
+                }
+            }
+        });
+    }
+
+    for (auto& writer : writers)
+    {
+        writer.join();
+    }
+    running.store(false);
+    for (auto& reader : threads)
+    {
+        reader.join();
+    }
+    expect_equal("concurrent writer results", wrong.load(), 0);
+    g_Delegate.detach();
+}
+
+void test_cross_rebind()
+{
+    //Handlers on two threads rebinding each other's delegates at the same time must not wait for each other
+    std::array<int, 32> large{};
+    g_Ping.attach([large] { rebind_other(g_Pong); });
+    g_Pong.attach([large](int) { rebind_other(g_Ping); });
+    std::thread ping([] { g_Ping(); });
+    std::thread pong([] { g_Pong(0); });
+    ping.join();
+    pong.join();
+    g_Ping();
+    g_Pong(0);
+    expect_equal("cross rebind calls", g_Arrived.load(), 22);
+    g_Ping.detach();
+    g_Pong.detach();
+}
+
+int main()
+{
+    test_kinds();
+    test_self_rebind();
+    test_concurrent_rebind();
+    test_concurrent_writers();
+    test_cross_rebind();
+
+    return finish("global delegate");
+}
@@ -0,0 +1,112 @@
+#include <functional>
+#include "EasyDelegate.hpp"
+#include "TestHarness.hpp"
+
+using namespace EasyDelegate;
+using namespace EasyDelegateTest;
+
+// Calls invoke_expect of TDelegate and TTypedDelegate with the attached function and with another one and checks
+// that both return the result of the attached callable, that raw_target exposes only static bindings and returns
+// nullptr for lambdas, methods and adapters, and that rebinding or detaching never leaves a stale target behind.
+
+namespace
+{
+    int add(int x, int y)
+    {
+        return x + y;
+    }
+
+    int multiply(int x, int y)
+    {
+        return x * y;
+    }
+
+    struct FAdder
+    {
+        int add(int x, int y) { return x + y + offset; }
+
+        int offset{100};
+    };
+
+    //Calls the body and reports whether it threw std::bad_function_call
+    template<class _Function>
+    bool throws_bad_call(_Function&& body)
+    {
+        try
+        {
+            body();
+        }
+        catch (const std::bad_function_call&)
+        {
+            return true;
+        }
+        return false;
+    }
+}
+
+void test_delegate()
+{
+    TDelegate<int(int, int)> hit(&add);
+    expect_equal("TDelegate hit", hit.invoke_expect<&add>(2, 3), 5);
+
+    TDelegate<int(int, int)> miss(&multiply);
+    expect_equal("TDelegate miss calls the attached function", miss.invoke_expect<&add>(2, 3), 6);
+
+    TDelegate<int(int, int)> staged(stage<&add>());
+    expect_equal("TDelegate stage hit", staged.invoke_expect<&add>(4, 5), 9);
+    expect_equal("TDelegate stage miss", staged.invoke_expect<&multiply>(4, 5), 9);
+
+    FAdder adder;
+    TDelegate<int(int, int)> method(&adder, &FAdder::add);
+    expect_equal("TDelegate method miss", method.invoke_expect<&add>(1, 2), 103);
+    TDelegate<int(int, int)> lambda([](int x, int y) { return x - y; });
+    expect_equal("TDelegate lambda miss", lambda.invoke_expect<&add>(7, 2), 5);
+
+    lambda.attach(&add);
+    expect_equal("TDelegate hit after rebinding", lambda.invoke_expect<&add>(7, 2), 9);
+    lambda.detach();
+    expect_equal("TDelegate empty throws", throws_bad_call([&lambda] { lambda.invoke_expect<&add>(1, 1); }), true);
+}
+
+void test_typed_delegate()
+{
+    TTypedDelegate<int(int, int)> typed(&add);
+    expect_equal("raw target of function", typed.raw_target() == &add, true);
+    expect_equal("TTypedDelegate hit", typed.invoke_expect<&add>(2, 3), 5);
+    expect_equal("TTypedDelegate miss", typed.invoke_expect<&multiply>(2, 3), 5);
+
+    typed.attach(stage<&multiply>());
+    expect_equal("raw target of stage", typed.raw_target() == &multiply, true);
+    expect_equal("TTypedDelegate stage hit", typed.invoke_expect<&multiply>(2, 3), 6);
+
+    //Objects don't expose a raw function, every call takes the delegate
+    FAdder adder;
+    typed.attach(&adder, &FAdder::add);
+    expect_equal("raw target of method", typed.raw_target() == nullptr, true);
+    expect_equal("TTypedDelegate method miss", typed.invoke_expect<&add>(1, 2), 103);
+
+    typed.attach([](int x, int y) { return x - y; });
+    expect_equal("raw target of lambda", typed.raw_target() == nullptr, true);
+    expect_equal("TTypedDelegate lambda miss", typed.invoke_expect<&add>(7, 2), 5);
+
+    typed.attach(reorder<1, 0>(&add));
+    expect_equal("raw target of reordered function", typed.raw_target() == nullptr, true);
+    typed.attach(std::function<int(int, int)>(&add));
+    expect_equal("raw target of std::function", typed.raw_target() == nullptr, true);
+    expect_equal("TTypedDelegate std::function miss", typed.invoke_expect<&add>(1, 2), 3);
+
+    typed.attach(static_cast<int (*)(int, int)>(nullptr));
+    expect_equal("raw target of null function", typed.raw_target() == nullptr, true);
+    typed.attach(&add);
+    typed.detach();
+    expect_equal("raw target after detach", typed.raw_target() == nullptr, true);
+    expect_equal("TTypedDelegate empty throws", throws_bad_call([&typed] { typed.invoke_expect<&add>(1, 1); }), true);
+}
+
+int main()
+{
+    test_delegate();
+    test_typed_delegate();
+
+    return finish("inline cache");
+}
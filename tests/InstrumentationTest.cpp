@@ -0,0 +1,122 @@
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "EasyDelegate.hpp"
+#include "TestHarness.hpp"
+
+using namespace EasyDelegate;
+using namespace EasyDelegateTest;
+
+// Calls instrumented containers from several threads with a manual clock and checks the per-key call counts,
+// cumulative ticks and histogram buckets merged from all threads, including the threads that already exited.
+
+enum class EStage
+{
+    EInput,
+    EUpdate,
+    EUnrecorded = 8
+};
+
+namespace
+{
+    //Every handler advances the clock of its thread, so the measured duration is exact
+    struct FManualClock
+    {
+        static inline uint64_t now() noexcept
+        {
+            return t_Now;
+        }
+
+        static inline thread_local uint64_t t_Now{0};
+    };
+
+    struct FStatsTag {};
+    using policy_t = TDelegateInstrumentation<FStatsTag, FManualClock, 8, 8>;
+
+    constexpr int g_Threads = 4;
+    constexpr int g_Calls = 1000;
+}
+
+void test_merged_counts()
+{
+    TDelegateMulti<EStage, void(uint64_t), __EnumeratorComp<EStage>, policy_t> stages;
+    stages.attach<EStage::EInput>([](uint64_t ticks) { FManualClock::t_Now += ticks; });
+    stages.attach<EStage::EUpdate>([](uint64_t ticks) { FManualClock::t_Now += ticks * 100; });
+    stages.attach<EStage::EUnrecorded>([](uint64_t ticks) { FManualClock::t_Now += ticks; });
+    TDelegate<void(uint64_t), policy_t> single([](uint64_t ticks) { FManualClock::t_Now += ticks; });
+
+    std::vector<std::thread> threads;
+    for (int index = 0; index < g_Threads; ++index)
+    {
+        threads.emplace_back([&stages, &single]()
+        {
+            for (int call = 0; call < g_Calls; ++call)
+            {
+                stages.execute<EStage::EInput>(5);
+                stages.execute(1);
+                single(0);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    //Counters of exited threads stay until reset
+    const auto input = policy_t::stats(EStage::EInput);
+    expect_equal("input calls", static_cast<long long>(input.calls), g_Threads * g_Calls * 2);
+    expect_equal("input ticks", static_cast<long long>(input.ticks), g_Threads * g_Calls * 6);
+    //5 ticks fall into [4, 8), 1 tick into [1, 2)
+    expect_equal("input bucket [4, 8)", static_cast<long long>(input.histogram[3]), g_Threads * g_Calls);
+    expect_equal("input bucket [1, 2)", static_cast<long long>(input.histogram[1]), g_Threads * g_Calls);
+
+    //100 ticks are above the last bucket bound and are counted by the last bucket
+    const auto update = policy_t::stats(EStage::EUpdate);
+    expect_equal("update calls", static_cast<long long>(update.calls), g_Threads * g_Calls);
+    expect_equal("update ticks", static_cast<long long>(update.ticks), g_Threads * g_Calls * 100);
+    expect_equal("update last bucket", static_cast<long long>(update.histogram[7]), g_Threads * g_Calls);
+
+    const auto delegate = policy_t::stats(DelegateKeyIndex);
+    expect_equal("delegate calls", static_cast<long long>(delegate.calls), g_Threads * g_Calls);
+    expect_equal("delegate bucket 0", static_cast<long long>(delegate.histogram[0]), g_Threads * g_Calls);
+
+    expect_equal("key outside of the kept keys", static_cast<long long>(policy_t::stats(EStage::EUnrecorded).calls), 0);
+
+    //A new thread recycles the record of an exited one and keeps its counters
+    std::thread([&stages]() { stages.execute<EStage::EUpdate>(1); }).join();
+    expect_equal("recycled record", static_cast<long long>(policy_t::stats(EStage::EUpdate).calls), g_Threads * g_Calls + 1);
+
+    policy_t::reset();
+    const auto cleared = policy_t::stats(EStage::EInput);
+    long long buckets{0};
+    for (auto bucket : cleared.histogram)
+    {
+        buckets += static_cast<long long>(bucket);
+    }
+    expect_equal("reset calls", static_cast<long long>(cleared.calls + cleared.ticks), 0);
+    expect_equal("reset histogram", buckets, 0);
+}
+
+void test_direct_record()
+{
+    policy_t::reset();
+    policy_t::record(TakeKeyIndex(EStage::EInput), 0);
+    policy_t::record(TakeKeyIndex(EStage::EInput), 127);
+    policy_t::record(TakeKeyIndex(EStage::EInput), 128);
+    policy_t::record(TakeKeyIndex(EStage::EUnrecorded), 1);
+
+    const auto input = policy_t::stats(EStage::EInput);
+    expect_equal("recorded calls", static_cast<long long>(input.calls), 3);
+    expect_equal("zero ticks bucket", static_cast<long long>(input.histogram[0]), 1);
+    expect_equal("long calls in the last bucket", static_cast<long long>(input.histogram[7]), 2);
+    expect_equal("unrecorded key", static_cast<long long>(policy_t::stats(EStage::EUnrecorded).calls), 0);
+}
+
+int main()
+{
+    test_merged_counts();
+    test_direct_record();
+
+    return finish("instrumentation");
+}
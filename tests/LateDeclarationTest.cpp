@@ -0,0 +1,24 @@
+#include "EasyDelegate.hpp"
+
+using namespace EasyDelegate;
+
+// Must fail to compile: the runtime key table has already looked the key up when it is declared, 
+// so the declaration would be left out of the table. LATE_DECLARATION_TEST passes when the compiler rejects it.
+
+enum class ELateKey
+{
+    EFirst,
+    ELate
+};
+
+DeclareDelegateFuncCompileTime(ELateKey, ELateKey::EFirst, void(int))
+
+//Same lookup as the table of TDelegateAnyCT<ELateKey>::execute(key, args...) does for the key
+static_assert(!__IsDelegateDeclared<TakeStoreKey<ELateKey, ELateKey::ELate>()>::value, "Key is not declared yet.");
+
+DeclareDelegateFuncCompileTime(ELateKey, ELateKey::ELate, void(int))
+
+int main()
+{
+    return TDelegateAnyCT<ELateKey>::execute(ELateKey::ELate, 1) ? 0 : 1;
+}
@@ -0,0 +1,156 @@
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+#include "EasyDelegate.hpp"
+#include "TestHarness.hpp"
+
+using namespace EasyDelegate;
+using namespace EasyDelegateTest;
+
+// Calls TMemoDelegate with repeating arguments and checks hits, CLOCK eviction inside the set, invalidation 
+// and that arguments are copied only when a new result is cached, for the shared and the per-thread cache.
+
+namespace
+{
+    int g_Copies{0};
+
+    //Argument counting its copies
+    struct FKey
+    {
+        explicit FKey(int v) : value(v) {}
+        FKey(const FKey& other) : value(other.value) { ++g_Copies; }
+        FKey(FKey&& other) noexcept : value(other.value) {}
+
+        bool operator==(const FKey& other) const { return value == other.value; }
+
+        int value;
+    };
+}
+
+template<>
+struct std::hash<FKey>
+{
+    std::size_t operator()(const FKey& key) const noexcept { return std::hash<int>{}(key.value); }
+};
+
+void test_hits_and_copies()
+{
+    int calls{0};
+    TMemoDelegate<int(const FKey&, const std::string&)> memo([&calls](const FKey& key, const std::string& text) 
+    { 
+        ++calls; 
+        return key.value + static_cast<int>(text.size()); 
+    });
+
+    const std::string text("abc");
+    expect_equal("first call", memo(FKey(1), text), 4);
+    expect_equal("cached call", memo(FKey(1), text), 4);
+    expect_equal("other arguments", memo(FKey(2), text), 5);
+    expect_equal("delegate calls", calls, 2);
+    expect_equal("hits", static_cast<long long>(memo.hits()), 1);
+    expect_equal("misses", static_cast<long long>(memo.misses()), 2);
+
+    //Only the inserted entries copy the key
+    g_Copies = 0;
+    const FKey key(1);
+    for (int i = 0; i < 10; ++i)
+    {
+        memo(key, text);
+    }
+    expect_equal("no copies on hits", g_Copies, 0);
+    memo(FKey(3), text);
+    expect_equal("one copy on insert", g_Copies, 1);
+}
+
+void test_eviction()
+{
+    //Single set of four entries
+    int calls{0};
+    TMemoDelegate<int(int), 4> memo([&calls](int value) { ++calls; return value * 2; });
+
+    for (int value = 0; value < 4; ++value)
+    {
+        memo(value);
+    }
+    expect_equal("set filled", calls, 4);
+    for (int value = 0; value < 4; ++value)
+    {
+        memo(value);
+    }
+    expect_equal("all cached", calls, 4);
+
+    //Fifth key replaces one entry, the other three stay cached
+    memo(4);
+    expect_equal("fifth key computed", calls, 5);
+    int evicted{0};
+    for (int value = 0; value < 4; ++value)
+    {
+        const int before = calls;
+        memo(value);
+        evicted += calls - before;
+        if (calls != before)
+        {
+            break;
+        }
+    }
+    expect_equal("single entry evicted", evicted, 1);
+}
+
+void test_invalidation()
+{
+    int scale{2};
+    TMemoDelegate<int(int)> memo([&scale](int value) { return value * scale; });
+    expect_equal("before invalidate", memo(5), 10);
+    scale = 3;
+    expect_equal("stale result", memo(5), 10);
+    memo.invalidate();
+    expect_equal("after invalidate", memo(5), 15);
+
+    memo.attach([](int value) { return value + 1; });
+    expect_equal("after attach", memo(5), 6);
+}
+
+void test_per_thread()
+{
+    std::atomic<int> calls{0};
+    int scale{2};
+    {
+        TMemoDelegate<int(int), 16, true> memo([&calls, &scale](int value) { ++calls; return value * scale; });
+        std::vector<std::thread> workers;
+        for (int i = 0; i < 4; ++i)
+        {
+            workers.emplace_back([&memo]
+            {
+                for (int round = 0; round < 10; ++round)
+                {
+                    memo(round % 2);
+                }
+            });
+        }
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+        expect_equal("own cache per thread", calls.load(), 8);
+
+        memo(1);
+        scale = 5;
+        memo.invalidate();
+        expect_equal("per-thread invalidate", memo(1), 5);
+    }
+
+    //Thread-local entry of the destroyed wrapper is never taken by the next one
+    TMemoDelegate<int(int), 16, true> other([](int value) { return value + 100; });
+    expect_equal("new wrapper after destroyed", other(1), 101);
+}
+
+int main()
+{
+    test_hits_and_copies();
+    test_eviction();
+    test_invalidation();
+    test_per_thread();
+
+    return finish("memo delegate");
+}
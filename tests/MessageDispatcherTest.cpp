@@ -0,0 +1,238 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "EasyDelegate.hpp"
+#include "TestHarness.hpp"
+
+using namespace EasyDelegate;
+using namespace EasyDelegateTest;
+
+// Decodes framed messages from a stand-in socket with TDelegateDispatcher and checks the arguments of every key,
+// that short and truncated payloads, unknown opcodes and keys without a delegate are rejected without a call,
+// that negative keys are dispatched and keys outside of the table rejected, and that payloads starting at odd offsets
+// of the receive buffer are decoded the same way.
+
+enum class EOpcode : uint8_t
+{
+    EBelow = 5,
+    EMove = 10,
+    EChat,
+    EUnused,
+    EPing,
+    EAbove
+};
+
+struct FVector
+{
+    float x, y, z;
+};
+
+DeclareDelegateFuncRuntime(EOpcode, EOpcode::EMove, void(uint32_t, const FVector&))
+DeclareDelegateFuncRuntime(EOpcode, EOpcode::EChat, void(uint32_t, char))
+DeclareDelegateFuncRuntime(EOpcode, EOpcode::EPing, void())
+
+enum class ESignedOpcode : int32_t
+{
+    ELowest = -100,
+    ERetreat = -3,
+    ENone = -1,
+    EAdvance = 2,
+    EHighest = 1000
+};
+
+DeclareDelegateFuncRuntime(ESignedOpcode, ESignedOpcode::ERetreat, void(int32_t))
+DeclareDelegateFuncRuntime(ESignedOpcode, ESignedOpcode::EAdvance, void(int32_t))
+
+namespace
+{
+    using dispatcher_t = TDelegateDispatcher<EOpcode, EOpcode::EMove, EOpcode::EChat, EOpcode::EPing>;
+
+    //Stand-in for the network layer: frames are [opcode][payload size][payload] packed back to back
+    struct FSocket
+    {
+        template<EOpcode eBase, class ...Args>
+        void send(Args&&... args)
+        {
+            std::byte payload[dispatcher_t::payload_size<eBase>() + 1];
+            const std::size_t size = dispatcher_t::encode<eBase>(payload, std::forward<Args>(args)...);
+            send_raw(eBase, payload, size);
+        }
+
+        void send_raw(EOpcode eKey, const std::byte* payload, std::size_t size)
+        {
+            buffer.push_back(static_cast<std::byte>(eKey));
+            buffer.push_back(static_cast<std::byte>(size));
+            buffer.insert(buffer.end(), payload, payload + size);
+        }
+
+        //Dispatches every received frame, returns the count of frames that reached a delegate
+        int receive(dispatcher_t& dispatcher)
+        {
+            int called{0};
+            std::size_t offset{0};
+            while (offset + 2 <= buffer.size())
+            {
+                const EOpcode eKey = static_cast<EOpcode>(buffer[offset]);
+                const std::size_t size = std::min<std::size_t>(static_cast<std::size_t>(buffer[offset + 1]), buffer.size() - offset - 2);
+                called += dispatcher.dispatch(eKey, buffer.data() + offset + 2, size) ? 1 : 0;
+                offset += 2 + size;
+            }
+            buffer.clear();
+            return called;
+        }
+
+        std::vector<std::byte> buffer;
+    };
+
+    struct FReceived
+    {
+        std::vector<int> moves;
+        std::vector<int> chats;
+        int pings{0};
+        FVector position{};
+    };
+
+    void attach_all(TDelegateAny<EOpcode>& any, FReceived& received)
+    {
+        any.attach<EOpcode::EMove>([&received](uint32_t id, const FVector& pos)
+        {
+            received.moves.push_back(static_cast<int>(id));
+            received.position = pos;
+        });
+        any.attach<EOpcode::EChat>([&received](uint32_t id, char c) { received.chats.push_back(static_cast<int>(id) * 1000 + c); });
+        any.attach<EOpcode::EPing>([&received]() { ++received.pings; });
+    }
+}
+
+void test_decode_per_key()
+{
+    TDelegateAny<EOpcode> any;
+    FReceived received;
+    attach_all(any, received);
+    dispatcher_t dispatcher(any);
+
+    expect_equal("move payload size", static_cast<long long>(dispatcher_t::payload_size<EOpcode::EMove>()), 16);
+    expect_equal("chat payload size", static_cast<long long>(dispatcher_t::payload_size<EOpcode::EChat>()), 5);
+    expect_equal("ping payload size", static_cast<long long>(dispatcher_t::payload_size<EOpcode::EPing>()), 0);
+
+    FSocket socket;
+    socket.send<EOpcode::EMove>(7u, FVector{1.5f, -2.f, 3.25f});
+    socket.send<EOpcode::EChat>(3u, 'a');
+    socket.send<EOpcode::EPing>();
+    socket.send<EOpcode::EChat>(4u, 'b');
+    expect_equal("dispatched frames", socket.receive(dispatcher), 4);
+
+    expect_calls("move ids", received.moves, {7});
+    expect_calls("chat ids and characters", received.chats, {3097, 4098});
+    expect_equal("pings", received.pings, 1);
+    expect_equal("position x", received.position.x == 1.5f, true);
+    expect_equal("position y", received.position.y == -2.f, true);
+    expect_equal("position z", received.position.z == 3.25f, true);
+}
+
+void test_short_payloads()
+{
+    TDelegateAny<EOpcode> any;
+    FReceived received;
+    attach_all(any, received);
+    dispatcher_t dispatcher(any);
+
+    std::byte payload[16]{};
+    dispatcher_t::encode<EOpcode::EMove>(payload, 1u, FVector{1.f, 2.f, 3.f});
+    expect_equal("empty payload", dispatcher.dispatch(EOpcode::EMove, payload, 0), false);
+    expect_equal("payload one byte short", dispatcher.dispatch(EOpcode::EMove, payload, 15), false);
+    expect_equal("chat payload one byte short", dispatcher.dispatch(EOpcode::EChat, payload, 4), false);
+    expect_equal("exact payload", dispatcher.dispatch(EOpcode::EMove, payload, 16), true);
+    expect_equal("empty payload without arguments", dispatcher.dispatch(EOpcode::EPing, nullptr, 0), true);
+
+    //Frame cut by the end of the receive buffer
+    FSocket socket;
+    socket.send<EOpcode::EChat>(2u, 'c');
+    socket.send<EOpcode::EMove>(5u, FVector{});
+    socket.buffer.resize(socket.buffer.size() - 3);
+    expect_equal("truncated frame dropped", socket.receive(dispatcher), 1);
+    expect_calls("only the complete frame is called", received.moves, {1});
+    expect_calls("complete chat frame", received.chats, {2099});
+}
+
+void test_unknown_opcodes()
+{
+    TDelegateAny<EOpcode> any;
+    FReceived received;
+    attach_all(any, received);
+    dispatcher_t dispatcher(any);
+
+    std::byte payload[16]{};
+    expect_equal("opcode below the table", dispatcher.dispatch(EOpcode::EBelow, payload, sizeof(payload)), false);
+    expect_equal("opcode inside the table without decoder", dispatcher.dispatch(EOpcode::EUnused, payload, sizeof(payload)), false);
+    expect_equal("opcode above the table", dispatcher.dispatch(EOpcode::EAbove, payload, sizeof(payload)), false);
+    expect_equal("opcode out of the enumeration", dispatcher.dispatch(static_cast<EOpcode>(255), payload, sizeof(payload)), false);
+
+    //Declared and dispatchable, but nothing attached
+    TDelegateAny<EOpcode> empty;
+    dispatcher_t idle(empty);
+    expect_equal("key without delegate", idle.dispatch(EOpcode::EPing, payload, 0), false);
+    any.detach<EOpcode::EPing>();
+    expect_equal("detached key", dispatcher.dispatch(EOpcode::EPing, payload, 0), false);
+
+    expect_equal("no calls", static_cast<long long>(received.moves.size() + received.chats.size()) + received.pings, 0);
+}
+
+void test_negative_keys()
+{
+    //Table spans the declared keys from -3 to 2, keys below and above it never index the table
+    using signed_dispatcher_t = TDelegateDispatcher<ESignedOpcode, ESignedOpcode::EAdvance, ESignedOpcode::ERetreat>;
+    std::vector<int> steps;
+    TDelegateAny<ESignedOpcode> any;
+    any.attach<ESignedOpcode::ERetreat>([&steps](int32_t value) { steps.push_back(-value); });
+    any.attach<ESignedOpcode::EAdvance>([&steps](int32_t value) { steps.push_back(value); });
+    signed_dispatcher_t dispatcher(any);
+
+    std::byte payload[4]{};
+    signed_dispatcher_t::encode<ESignedOpcode::ERetreat>(payload, 5);
+    expect_equal("negative key", dispatcher.dispatch(ESignedOpcode::ERetreat, payload, sizeof(payload)), true);
+    signed_dispatcher_t::encode<ESignedOpcode::EAdvance>(payload, 7);
+    expect_equal("positive key", dispatcher.dispatch(ESignedOpcode::EAdvance, payload, sizeof(payload)), true);
+    expect_equal("unknown negative key inside the table", dispatcher.dispatch(ESignedOpcode::ENone, payload, sizeof(payload)), false);
+    expect_equal("negative key below the table", dispatcher.dispatch(ESignedOpcode::ELowest, payload, sizeof(payload)), false);
+    expect_equal("key above the table", dispatcher.dispatch(ESignedOpcode::EHighest, payload, sizeof(payload)), false);
+    expect_equal("lowest value of the enumeration", dispatcher.dispatch(static_cast<ESignedOpcode>(INT32_MIN), payload, sizeof(payload)), false);
+    expect_equal("highest value of the enumeration", dispatcher.dispatch(static_cast<ESignedOpcode>(INT32_MAX), payload, sizeof(payload)), false);
+    expect_calls("negative and positive keys called", steps, {-5, 7});
+}
+
+void test_misaligned_payloads()
+{
+    TDelegateAny<EOpcode> any;
+    FReceived received;
+    attach_all(any, received);
+    dispatcher_t dispatcher(any);
+
+    //Every offset of the payload inside the buffer, including the ones misaligned for uint32_t and float
+    std::vector<std::byte> buffer(dispatcher_t::payload_size<EOpcode::EMove>() + 8);
+    for (std::size_t offset = 0; offset < 8; ++offset)
+    {
+        dispatcher_t::encode<EOpcode::EMove>(buffer.data() + offset, static_cast<uint32_t>(100 + offset), FVector{0.5f, 0.25f, static_cast<float>(offset)});
+        expect_equal("misaligned dispatch", dispatcher.dispatch(EOpcode::EMove, buffer.data() + offset, dispatcher_t::payload_size<EOpcode::EMove>()), true);
+        expect_equal("misaligned float", received.position.z == static_cast<float>(offset) && received.position.y == 0.25f, true);
+    }
+    expect_calls("misaligned ids", received.moves, {100, 101, 102, 103, 104, 105, 106, 107});
+
+    //Buffer overload takes the size of the whole container
+    std::vector<std::byte> chat(dispatcher_t::payload_size<EOpcode::EChat>());
+    dispatcher_t::encode<EOpcode::EChat>(chat.data(), 9u, 'z');
+    expect_equal("container dispatch", dispatcher.dispatch(EOpcode::EChat, chat), true);
+    expect_calls("container chat", received.chats, {9122});
+}
+
+int main()
+{
+    test_decode_per_key();
+    test_short_payloads();
+    test_unknown_opcodes();
+    test_negative_keys();
+    test_misaligned_payloads();
+
+    return finish("message dispatcher");
+}
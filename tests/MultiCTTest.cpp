@@ -0,0 +1,136 @@
+#include <array>
+#include <memory>
+#include <vector>
+#include "EasyDelegate.hpp"
+#include "TestHarness.hpp"
+
+using namespace EasyDelegate;
+using namespace EasyDelegateTest;
+
+// Dispatches through TDelegateMultiCT and checks that handlers are called and evaluated in order of declaration
+// regardless of the key values, that calls by key reach the bound handler and that __BroadcastForwardLast moves
+// the rvalue only into the last handler while the others see the original value.
+
+enum class EPhase
+{
+    EFirst,
+    ESecond,
+    EThird
+};
+
+namespace
+{
+    std::vector<int> g_Calls;
+    int g_Copies{0};
+    int g_Moves{0};
+
+    //Value counting its copies and moves, moved-from values are emptied
+    struct FMessage
+    {
+        explicit FMessage(int v) : value(v) {}
+        FMessage(const FMessage& other) : value(other.value) { ++g_Copies; }
+        FMessage(FMessage&& other) noexcept : value(other.value) { other.value = 0; ++g_Moves; }
+
+        int value;
+    };
+
+    template<int _Id>
+    void mark(int x)
+    {
+        g_Calls.push_back(_Id * 100 + x);
+    }
+
+    template<int _Id>
+    int value(int x)
+    {
+        g_Calls.push_back(_Id);
+        return _Id * 10 + x;
+    }
+
+    template<int _Id>
+    void receive(FMessage message)
+    {
+        g_Calls.push_back(_Id * 100 + message.value);
+    }
+
+    int g_Owned{0};
+
+    void own(std::unique_ptr<int> value)
+    {
+        g_Owned = *value;
+    }
+}
+
+void test_declaration_order()
+{
+    //Keys are declared out of their enumerator order
+    using handlers_t = TDelegateMultiCT<EPhase, void(int),
+        TDelegateSlot<EPhase::EThird, &mark<3>>,
+        TDelegateSlot<EPhase::EFirst, &mark<1>>,
+        TDelegateSlot<EPhase::ESecond, &mark<2>>>;
+
+    static_assert(handlers_t::size() == 3, "Every slot is counted.");
+    static_assert(handlers_t::index<EPhase::EThird>() == 0 && handlers_t::index<EPhase::ESecond>() == 2, "Index follows the declaration.");
+
+    g_Calls.clear();
+    handlers_t::execute(5);
+    expect_calls("execute in declaration order", g_Calls, {305, 105, 205});
+
+    g_Calls.clear();
+    handlers_t::execute<EPhase::ESecond>(7);
+    expect_calls("execute by key", g_Calls, {207});
+
+    using values_t = TDelegateMultiCT<EPhase, int(int),
+        TDelegateSlot<EPhase::ESecond, &value<2>>,
+        TDelegateSlot<EPhase::EThird, &value<3>>,
+        TDelegateSlot<EPhase::EFirst, &value<1>>>;
+
+    g_Calls.clear();
+    const std::array<int, 3> results = values_t::eval(1);
+    expect_calls("eval called in declaration order", g_Calls, {2, 3, 1});
+    expect_calls("eval results in declaration order", {results.begin(), results.end()}, {21, 31, 11});
+    expect_equal("result of the key at its index", results[values_t::index<EPhase::EFirst>()], 11);
+    expect_equal("eval by key", values_t::eval<EPhase::EThird>(4), 34);
+}
+
+void test_broadcast()
+{
+    using handlers_t = TDelegateMultiCT<EPhase, void(FMessage),
+        TDelegateSlot<EPhase::EFirst, &receive<1>>,
+        TDelegateSlot<EPhase::ESecond, &receive<2>>,
+        TDelegateSlot<EPhase::EThird, &receive<3>>>;
+
+    g_Calls.clear();
+    g_Copies = g_Moves = 0;
+    handlers_t::execute(FMessage(4));
+    expect_calls("const broadcast values", g_Calls, {104, 204, 304});
+    expect_equal("const broadcast copies into every handler", g_Copies, 3);
+    expect_equal("const broadcast never moves", g_Moves, 0);
+
+    g_Calls.clear();
+    g_Copies = g_Moves = 0;
+    handlers_t::execute<__BroadcastForwardLast>(FMessage(6));
+    expect_calls("forwarded broadcast values", g_Calls, {106, 206, 306});
+    expect_equal("forward last copies before the last handler", g_Copies, 2);
+    expect_equal("forward last moves into the last handler", g_Moves, 1);
+
+    //Lvalues are never moved from
+    FMessage kept(8);
+    g_Calls.clear();
+    handlers_t::execute<__BroadcastForwardLast>(kept);
+    expect_calls("lvalue broadcast", g_Calls, {108, 208, 308});
+    expect_equal("lvalue kept", kept.value, 8);
+
+    //Move-only argument reaches the single handler
+    using owner_t = TDelegateMultiCT<EPhase, void(std::unique_ptr<int>), TDelegateSlot<EPhase::EFirst, &own>>;
+    owner_t::execute<__BroadcastForwardLast>(std::make_unique<int>(9));
+    expect_equal("move-only forwarded", g_Owned, 9);
+}
+
+int main()
+{
+    test_declaration_order();
+    test_broadcast();
+
+    return finish("multi ct");
+}
@@ -0,0 +1,288 @@
+#include <functional>
+#include <vector>
+#include "EasyDelegate.hpp"
+#include "TestHarness.hpp"
+
+using namespace EasyDelegate;
+using namespace EasyDelegateTest;
+
+// Mutes and unmutes keys of TDelegateMulti and checks that execute and eval call only the attached and enabled 
+// delegates, in key order, across several mask words and for negative and sparse keys. Category masks select a subset of them.
+
+enum class EKey : uint32_t
+{
+    EFirst,
+    ESecond,
+    EThird,
+    EFar = 130
+};
+
+//Calls the body and reports whether it threw std::bad_function_call
+template<class _Function>
+bool throws_bad_call(_Function&& body)
+{
+    try
+    {
+        body();
+    }
+    catch (const std::bad_function_call&)
+    {
+        return true;
+    }
+    return false;
+}
+
+void test_enable_disable()
+{
+    std::vector<int> calls;
+    TDelegateMulti<EKey, void(int)> multi;
+    multi.attach<EKey::EFar>([&calls](int) { calls.push_back(130); });
+    multi.attach<EKey::EFirst>([&calls](int) { calls.push_back(0); });
+    multi.attach<EKey::EThird>([&calls](int) { calls.push_back(2); });
+
+    multi.execute(1);
+    expect_calls("execute in key order", calls, {0, 2, 130});
+
+    calls.clear();
+    multi.disable<EKey::EThird>();
+    multi.execute(1);
+    multi.execute<EKey::EThird>(1);
+    multi.operator()<EKey::EThird>(1);
+    expect_calls("disabled key skipped", calls, {0, 130});
+    expect_equal("disabled state", multi.enabled<EKey::EThird>(), 0);
+
+    //Muted state survives detach and attach
+    calls.clear();
+    multi.detach<EKey::EThird>();
+    multi.attach<EKey::EThird>([&calls](int) { calls.push_back(3); });
+    multi.execute(1);
+    expect_calls("muted after reattach", calls, {0, 130});
+
+    calls.clear();
+    multi.enable<EKey::EThird>();
+    multi.execute(1);
+    expect_calls("enabled again", calls, {0, 3, 130});
+}
+
+void test_bulk()
+{
+    std::vector<int> calls;
+    TDelegateMulti<EKey, int(int)> multi;
+    multi.attach<EKey::EFirst>([](int value) { return value; });
+    multi.attach<EKey::ESecond>([](int value) { return value * 2; });
+    multi.attach<EKey::EFar>([](int value) { return value * 3; });
+
+    multi.disable(TDelegateKeyMask<EKey>{EKey::EFirst, EKey::EFar});
+    auto results = multi.eval(5);
+    expect_equal("bulk disable results", results.size(), 1);
+    expect_equal("bulk disable value", results[EKey::ESecond], 10);
+    expect_equal("enabled mask", multi.enabled_mask().count(), 1);
+
+    multi.enable(TDelegateKeyMask<EKey>{EKey::EFar});
+    expect_equal("bulk enable", multi.eval(5).size(), 2);
+
+    multi.disable_all();
+    expect_equal("disable all", multi.eval(5).size(), 0);
+    //Keyed calls that return a value throw for the muted key instead of calling it
+    expect_equal("eval muted key throws", throws_bad_call([&multi] { multi.eval<EKey::ESecond>(5); }), true);
+    expect_equal("operator() muted key throws", throws_bad_call([&multi] { multi.operator()<EKey::ESecond>(5); }), true);
+    multi.enable<EKey::ESecond>();
+    expect_equal("eval enabled key", multi.eval<EKey::ESecond>(5), 10);
+    expect_equal("operator() enabled key", multi.operator()<EKey::ESecond>(5), 10);
+
+    multi.enable_all();
+    expect_equal("enable all", multi.eval(5).size(), 3);
+}
+
+void test_copy_and_detach()
+{
+    int sum{0};
+    TDelegateMulti<EKey, void(int)> multi;
+    multi.attach<EKey::EFirst>([&sum](int value) { sum += value; });
+    multi.attach<EKey::ESecond>([&sum](int value) { sum += value * 10; });
+    multi.disable<EKey::ESecond>();
+
+    //Copy calls its own delegates and keeps the masks
+    TDelegateMulti<EKey, void(int)> copy(multi);
+    multi.detach<EKey::EFirst>();
+    copy.execute(1);
+    expect_equal("copy execute", sum, 1);
+
+    //Delegate detaching the next one
+    sum = 0;
+    TDelegateMulti<EKey, void(int)> self;
+    self.attach<EKey::EFirst>([&self, &sum](int value) { sum += value; self.detach<EKey::ESecond>(); });
+    self.attach<EKey::ESecond>([&sum](int value) { sum += value * 10; });
+    self.execute(1);
+    expect_equal("detached during execute", sum, 1);
+}
+
+void test_call_before_attach()
+{
+    //Calling the key before attaching throws and must not leave an empty delegate behind
+    std::vector<int> calls;
+    TDelegateMulti<EKey, void(int)> multi;
+    expect_equal("execute of missing key throws", throws_bad_call([&multi] { multi.execute<EKey::ESecond>(1); }), true);
+    multi.attach<EKey::ESecond>([&calls](int value) { calls.push_back(value); });
+    multi.execute<EKey::ESecond>(2);
+    multi.execute(3);
+    expect_calls("attach after execute of the key", calls, {2, 3});
+
+    TDelegateMulti<EKey, int(int)> evaluated;
+    expect_equal("eval of missing key throws", throws_bad_call([&evaluated] { evaluated.eval<EKey::EFirst>(1); }), true);
+    evaluated.attach<EKey::EFirst>([](int value) { return value * 4; });
+    expect_equal("attach after eval of the key", evaluated.eval<EKey::EFirst>(2), 8);
+    expect_equal("operator() of the key", evaluated.operator()<EKey::EFirst>(3), 12);
+}
+
+void test_categories()
+{
+    std::vector<int> calls;
+    TDelegateMulti<EKey, void(int)> multi;
+    multi.attach<EKey::EFirst>([&calls](int value) { calls.push_back(value); });
+    multi.attach<EKey::ESecond>([&calls](int value) { calls.push_back(value * 10); });
+    multi.attach<EKey::EThird>([&calls](int value) { calls.push_back(value * 100); });
+    multi.attach<EKey::EFar>([&calls](int value) { calls.push_back(value * 1000); });
+
+    const auto& outer = key_mask<EKey::EFar, EKey::EFirst>();
+    multi.execute(outer, 1);
+    expect_calls("category in key order", calls, {1, 1000});
+
+    //Category is intersected with the attached and enabled keys
+    calls.clear();
+    multi.disable<EKey::EFar>();
+    multi.detach<EKey::EFirst>();
+    multi.execute(outer | TDelegateKeyMask<EKey>{EKey::EThird}, 2);
+    expect_calls("category and enabled", calls, {200});
+
+    //Mask shorter than the attached keys
+    calls.clear();
+    TDelegateKeyMask<EKey> inner{EKey::ESecond};
+    multi.enable_all();
+    multi.execute(inner, 3);
+    expect_calls("short category", calls, {30});
+
+    TDelegateMulti<EKey, int(int)> evaluated;
+    evaluated.attach<EKey::EFirst>([](int value) { return value; });
+    evaluated.attach<EKey::EFar>([](int value) { return value * 2; });
+    auto results = evaluated.eval<TBroadcastForwardLast>(outer, 4);
+    expect_equal("category eval size", results.size(), 2);
+    expect_equal("category eval far", results[EKey::EFar], 8);
+    expect_equal("empty category", evaluated.eval(TDelegateKeyMask<EKey>{}, 4).size(), 0);
+}
+
+enum class ESparseKey : int32_t
+{
+    ENegative = -5,
+    ELow = -1,
+    EZero = 0,
+    EDense = 100,
+    EHuge = 100000000
+};
+
+void test_sparse_keys()
+{
+    //Negative and large keys don't grow the bit words, calls keep the key order
+    std::vector<int> calls;
+    TDelegateMulti<ESparseKey, void(int)> multi;
+    multi.attach<ESparseKey::EHuge>([&calls](int value) { calls.push_back(value * 4); });
+    multi.attach<ESparseKey::EDense>([&calls](int value) { calls.push_back(value * 3); });
+    multi.attach<ESparseKey::ELow>([&calls](int value) { calls.push_back(value * 2); });
+    multi.attach<ESparseKey::ENegative>([&calls](int value) { calls.push_back(value); });
+
+    multi.execute(1);
+    expect_calls("sparse keys in key order", calls, {1, 2, 3, 4});
+
+    calls.clear();
+    expect_equal("sparse missing key throws", throws_bad_call([&multi] { multi.execute<ESparseKey::EZero>(1); }), true);
+    multi.execute<ESparseKey::EHuge>(1);
+    multi.execute<ESparseKey::ENegative>(1);
+    expect_calls("sparse key calls", calls, {4, 1});
+
+    calls.clear();
+    multi.disable<ESparseKey::ELow>();
+    multi.detach<ESparseKey::EHuge>();
+    multi.execute(TDelegateKeyMask<ESparseKey>{ESparseKey::ELow, ESparseKey::EHuge, ESparseKey::EDense, ESparseKey::ENegative}, 2);
+    expect_calls("sparse category", calls, {2, 6});
+    expect_equal("sparse enabled mask", multi.enabled_mask().count(), 2);
+
+    calls.clear();
+    multi.enable_all();
+    const auto frozen = multi.freeze();
+    frozen.execute(3);
+    frozen.execute<ESparseKey::ENegative>(1);
+    expect_calls("sparse frozen", calls, {3, 6, 9, 1});
+    expect_equal("sparse frozen contains", frozen.contains<ESparseKey::ELow>(), 1);
+
+    TDelegateMulti<ESparseKey, int(int)> evaluated;
+    evaluated.attach<ESparseKey::ENegative>([](int value) { return -value; });
+    evaluated.attach<ESparseKey::EHuge>([](int value) { return value * 2; });
+    expect_equal("sparse eval key", evaluated.eval<ESparseKey::ENegative>(4), -4);
+    auto results = evaluated.eval<TBroadcastForwardLast>(4);
+    expect_equal("sparse eval size", results.size(), 2);
+    expect_equal("sparse eval huge", results[ESparseKey::EHuge], 8);
+}
+
+//Orders the keys from the last to the first
+struct FReverseComp
+{
+    bool operator()(EKey left, EKey right) const
+    {
+        return static_cast<uint32_t>(left) > static_cast<uint32_t>(right);
+    }
+};
+
+void test_comparator()
+{
+    //Custom comparator decides the order of the calls
+    std::vector<int> calls;
+    TDelegateMulti<EKey, void(int), FReverseComp> multi;
+    multi.attach<EKey::EFirst>([&calls](int value) { calls.push_back(value); });
+    multi.attach<EKey::EThird>([&calls](int value) { calls.push_back(value * 3); });
+    multi.attach<EKey::EFar>([&calls](int value) { calls.push_back(value * 130); });
+    multi.attach<EKey::ESecond>([&calls](int value) { calls.push_back(value * 2); });
+
+    multi.execute(1);
+    expect_calls("comparator order", calls, {130, 3, 2, 1});
+
+    calls.clear();
+    multi.disable<EKey::ESecond>();
+    multi.execute(key_mask<EKey::EFirst, EKey::ESecond, EKey::EFar>(), 1);
+    expect_calls("comparator category", calls, {130, 1});
+
+    //Handler detaching the next key in the order
+    calls.clear();
+    multi.detach<EKey::EFar>();
+    multi.attach<EKey::EFar>([&calls, &multi](int value) { calls.push_back(value * 130); multi.detach<EKey::EThird>(); });
+    multi.execute(1);
+    expect_calls("comparator detach during call", calls, {130, 1});
+
+    calls.clear();
+    multi.attach<EKey::EThird>([&calls](int value) { calls.push_back(value * 3); });
+    multi.enable_all();
+    const auto frozen = multi.freeze();
+    multi.detach<EKey::EFar>();
+    frozen.execute(1);
+    frozen.execute(key_mask<EKey::EFirst, EKey::EThird>(), 2);
+    expect_calls("frozen comparator order", calls, {130, 3, 2, 1, 6, 2});
+
+    TDelegateMulti<EKey, int(int), FReverseComp> evaluated;
+    std::vector<int> order;
+    evaluated.attach<EKey::EFirst>([&order](int value) { order.push_back(1); return value; });
+    evaluated.attach<EKey::EThird>([&order](int value) { order.push_back(3); return value; });
+    evaluated.eval(1);
+    expect_calls("comparator eval order", order, {3, 1});
+}
+
+int main()
+{
+    test_enable_disable();
+    test_bulk();
+    test_copy_and_detach();
+    test_call_before_attach();
+    test_categories();
+    test_sparse_keys();
+    test_comparator();
+
+    return finish("multi mask");
+}
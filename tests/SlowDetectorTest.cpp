@@ -0,0 +1,147 @@
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "EasyDelegate.hpp"
+#include "TestHarness.hpp"
+
+using namespace EasyDelegate;
+using namespace EasyDelegateTest;
+
+// Calls delegates instrumented with TDelegateSlowDetector under a manual clock and checks that only calls above the
+// threshold are reported, with their key, duration and thread, that per-key thresholds override the common one and
+// that a full ring drops and counts reports while several threads report concurrently.
+
+enum class EHandler
+{
+    EFast,
+    ESlow
+};
+
+namespace
+{
+    //Every handler advances the clock of its thread by its argument
+    struct FManualClock
+    {
+        static inline uint64_t now() noexcept
+        {
+            return t_Now;
+        }
+
+        static inline thread_local uint64_t t_Now{0};
+    };
+
+    void spend(uint64_t ticks)
+    {
+        FManualClock::t_Now += ticks;
+    }
+}
+
+void test_threshold()
+{
+    struct FTag {};
+    using detector_t = TDelegateSlowDetector<FTag, FManualClock, 16>;
+    TDelegate<void(uint64_t), detector_t> single(&spend);
+    TDelegateMulti<EHandler, void(uint64_t), __EnumeratorComp<EHandler>, detector_t> handlers;
+    handlers.attach<EHandler::EFast>(&spend);
+    handlers.attach<EHandler::ESlow>(&spend);
+
+    //Nothing is reported before a threshold is set
+    single(1000);
+    __DelegateSlowReport report;
+    expect_equal("no threshold", detector_t::poll(report), false);
+
+    detector_t::threshold(10);
+    single(10);
+    expect_equal("call at the threshold", detector_t::poll(report), false);
+    single(11);
+    expect_equal("call above the threshold", detector_t::poll(report), true);
+    expect_equal("report key", report.key, DelegateKeyIndex);
+    expect_equal("report duration", static_cast<long long>(report.duration), 11);
+    expect_equal("report timestamp", static_cast<long long>(report.timestamp), static_cast<long long>(FManualClock::t_Now));
+    expect_equal("report thread", report.thread == std::this_thread::get_id(), true);
+    expect_equal("single report", detector_t::poll(report), false);
+
+    //Own threshold of the key overrides the common one, zero restores it
+    detector_t::threshold(EHandler::ESlow, 100);
+    handlers.execute(50);
+    std::vector<int> keys;
+    detector_t::drain([&keys](const __DelegateSlowReport& slow) { keys.push_back(static_cast<int>(slow.key)); });
+    expect_calls("only the key without own threshold", keys, {static_cast<int>(EHandler::EFast)});
+
+    detector_t::threshold(EHandler::ESlow, 0);
+    handlers.execute<EHandler::ESlow>(50);
+    expect_equal("common threshold restored", static_cast<long long>(detector_t::drain([](const __DelegateSlowReport&) {})), 1);
+    expect_equal("nothing dropped", static_cast<long long>(detector_t::dropped()), 0);
+}
+
+void test_full_ring()
+{
+    struct FTag {};
+    using detector_t = TDelegateSlowDetector<FTag, FManualClock, 4>;
+    TDelegate<void(uint64_t), detector_t> single(&spend);
+    detector_t::threshold(1);
+
+    for (uint64_t call = 0; call < 6; ++call)
+    {
+        single(2 + call);
+    }
+    expect_equal("dropped when full", static_cast<long long>(detector_t::dropped()), 2);
+    std::vector<int> durations;
+    detector_t::drain([&durations](const __DelegateSlowReport& slow) { durations.push_back(static_cast<int>(slow.duration)); });
+    expect_calls("oldest reports kept in order", durations, {2, 3, 4, 5});
+
+    //The ring is reused after draining
+    single(9);
+    __DelegateSlowReport report;
+    expect_equal("report after drain", detector_t::poll(report) && report.duration == 9, true);
+}
+
+void test_concurrent_reports()
+{
+    struct FTag {};
+    using detector_t = TDelegateSlowDetector<FTag, FManualClock, 64>;
+    TDelegate<void(uint64_t), detector_t> single(&spend);
+    detector_t::threshold(5);
+
+    constexpr int threads = 4;
+    constexpr int calls = 2000;
+    std::atomic<int> finished{0};
+    std::vector<std::thread> producers;
+    for (int index = 0; index < threads; ++index)
+    {
+        producers.emplace_back([&single, &finished]()
+        {
+            for (int call = 0; call < calls; ++call)
+            {
+                single(call % 2 ? 6 : 5);
+            }
+            finished.fetch_add(1);
+        });
+    }
+
+    //Monitoring thread drains while the producers report
+    long long received{0}, wrong{0};
+    auto visit = [&wrong](const __DelegateSlowReport& slow) { wrong += slow.duration != 6 ? 1 : 0; };
+    while (finished.load() < threads)
+    {
+        received += static_cast<long long>(detector_t::drain(visit));
+    }
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    received += static_cast<long long>(detector_t::drain(visit));
+
+    expect_equal("reports under the threshold", wrong, 0);
+    expect_equal("received and dropped reports", received + static_cast<long long>(detector_t::dropped()), threads * calls / 2);
+}
+
+int main()
+{
+    test_threshold();
+    test_full_ring();
+    test_concurrent_reports();
+
+    return finish("slow detector");
+}
@@ -0,0 +1,47 @@
+#pragma once
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+/**
+ * @brief Minimal self-contained test fixture shared by the test executables. Failed checks are printed 
+ * and counted, finish() turns the count into the exit code for ctest.
+ */
+namespace EasyDelegateTest
+{
+    inline int g_Failures{0};
+
+    inline void expect_equal(const char* name, long long actual, long long expected)
+    {
+        if (actual != expected)
+        {
+            std::fprintf(stderr, "FAILED %s: %lld, expected %lld\n", name, actual, expected);
+            ++g_Failures;
+        }
+    }
+
+    //Compares the sequence of recorded calls
+    inline void expect_calls(const char* name, const std::vector<int>& actual, const std::vector<int>& expected)
+    {
+        if (actual != expected)
+        {
+            std::fprintf(stderr, "FAILED %s: %zu calls, expected %zu\n", name, actual.size(), expected.size());
+            ++g_Failures;
+        }
+    }
+
+    /**
+     * @brief Reports the result of the test executable
+     * 
+     * @param suite Name printed when every check passed
+     * @return Exit code
+     */
+    inline int finish(const char* suite)
+    {
+        if (g_Failures == 0)
+        {
+            std::printf("All %s checks passed\n", suite);
+        }
+        return g_Failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,192 @@
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include "EasyDelegate.hpp"
+#include "TestHarness.hpp"
+
+using namespace EasyDelegate;
+using namespace EasyDelegateTest;
+
+// Checks TDelegateThreadPool and invoke_async: exceptions reach the caller through the future, idle workers steal tasks
+// queued by a busy worker, calls run inline in the caller when every queue is full, and keyed calls of TDelegateMulti
+// and TDelegateAny return the result of the delegate attached to the key.
+
+enum class EJob
+{
+    EAdd,
+    EScale,
+    EMissing
+};
+
+DeclareDelegateFuncRuntime(EJob, EJob::EAdd, int(int, int))
+DeclareDelegateFuncRuntime(EJob, EJob::EScale, int(int))
+
+namespace
+{
+    //Waits for the flag without blocking the test forever when the pool misbehaves
+    bool wait_for(const std::atomic<bool>& flag)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (!flag.load() && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::yield();
+        }
+        return flag.load();
+    }
+
+    //Records the thread that ran the call
+    struct FRecordThread
+    {
+        void operator()(int) const
+        {
+            *thread = std::this_thread::get_id();
+        }
+
+        std::thread::id* thread;
+    };
+}
+
+void test_exceptions()
+{
+    TDelegateThreadPool pool(2);
+    TDelegate<int(int)> checked([](int x)
+    {
+        if (x < 0)
+        {
+            throw std::invalid_argument("negative");
+        }
+        return x * 2;
+    });
+
+    auto failed = pool.submit(std::ref(checked), -1);
+    bool thrown{false};
+    try
+    {
+        failed.get();
+    }
+    catch (const std::invalid_argument&)
+    {
+        thrown = true;
+    }
+    expect_equal("exception through the future", thrown, true);
+
+    auto passed = pool.submit(std::ref(checked), 21);
+    expect_equal("pool works after exception", passed.get(), 42);
+
+    auto async = checked.invoke_async(-5);
+    thrown = false;
+    try
+    {
+        async.get();
+    }
+    catch (const std::invalid_argument&)
+    {
+        thrown = true;
+    }
+    expect_equal("exception through invoke_async", thrown, true);
+}
+
+void test_work_stealing()
+{
+    TDelegateThreadPool pool(2);
+    std::atomic<bool> stolen{false};
+
+    //Tasks submitted by a worker go to its own queue, the worker stays busy until the other worker steals one
+    auto outer = pool.submit([&pool, &stolen]()
+    {
+        const std::thread::id owner = std::this_thread::get_id();
+        auto steal = [owner, &stolen]()
+        {
+            if (std::this_thread::get_id() != owner)
+            {
+                stolen.store(true);
+            }
+        };
+        auto first = pool.submit(steal);
+        auto second = pool.submit(steal);
+        auto third = pool.submit(steal);
+        return wait_for(stolen);
+    });
+    expect_equal("idle worker stole a task", outer.get(), true);
+}
+
+void test_inline_fallback()
+{
+    TDelegateThreadPool pool(1);
+    std::atomic<bool> started{false}, release{false};
+    auto blocker = pool.submit([&started, &release]()
+    {
+        started.store(true);
+        wait_for(release);
+    });
+    expect_equal("worker busy", wait_for(started), true);
+
+    //The only queue holds 1024 tasks, the next call runs in the caller thread before submit returns
+    using future_t = TDelegateFuture<FRecordThread, int>;
+    constexpr int queued = 1024;
+    auto threads = std::make_unique<std::thread::id[]>(queued + 1);
+    auto futures = std::make_unique<std::optional<future_t>[]>(queued + 1);
+    for (int index = 0; index < queued; ++index)
+    {
+        futures[index].emplace(pool, FRecordThread{&threads[index]}, index);
+    }
+    expect_equal("queued calls wait", futures[0]->ready(), false);
+
+    futures[queued].emplace(pool, FRecordThread{&threads[queued]}, queued);
+    expect_equal("overflow call ready on submit", futures[queued]->ready(), true);
+    expect_equal("overflow call ran in the caller", threads[queued] == std::this_thread::get_id(), true);
+
+    release.store(true);
+    blocker.wait();
+    for (int index = 0; index < queued; ++index)
+    {
+        futures[index]->wait();
+    }
+    expect_equal("queued calls finished", futures[queued - 1]->ready(), true);
+}
+
+void test_keyed_async()
+{
+    TDelegateMulti<EJob, int(int, int)> multi;
+    multi.attach<EJob::EAdd>([](int x, int y) { return x + y; });
+    multi.attach<EJob::EScale>([](int x, int y) { return x * y; });
+
+    auto added = multi.invoke_async<EJob::EAdd>(2, 3);
+    auto scaled = multi.invoke_async<EJob::EScale>(4, 5);
+    expect_equal("multi invoke_async add", added.get(), 5);
+    expect_equal("multi invoke_async scale", scaled.get(), 20);
+
+    bool thrown{false};
+    try
+    {
+        auto missing = multi.invoke_async<EJob::EMissing>(1, 1);
+    }
+    catch (const std::bad_function_call&)
+    {
+        thrown = true;
+    }
+    expect_equal("multi missing key throws in the caller", thrown, true);
+
+    TDelegateAny<EJob> any;
+    any.attach<EJob::EAdd>([](int x, int y) { return x + y; });
+    any.attach<EJob::EScale>([](int x) { return x * 10; });
+
+    auto anyAdded = any.invoke_async<EJob::EAdd>(7, 8);
+    auto anyScaled = any.invoke_async<EJob::EScale>(6);
+    expect_equal("any invoke_async add", anyAdded.get(), 15);
+    expect_equal("any invoke_async scale", anyScaled.get(), 60);
+}
+
+int main()
+{
+    test_exceptions();
+    test_work_stealing();
+    test_inline_fallback();
+    test_keyed_async();
+
+    return finish("thread pool");
+}
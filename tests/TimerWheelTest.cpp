@@ -0,0 +1,189 @@
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "EasyDelegate.hpp"
+#include "TestHarness.hpp"
+
+using namespace EasyDelegate;
+using namespace EasyDelegateTest;
+
+// Drives the timing wheel with a manual clock and checks that every timer fires exactly at its expiry, 
+// including timers cascaded from the higher levels, periodic timers and timers cancelled from delegates,
+// that a throwing delegate neither leaks its timer nor drops the timers expired with it and that long jumps of the clock fire on time.
+
+void test_single_shot()
+{
+    TDelegateTimerWheel wheel;
+    std::vector<uint64_t> delays{0, 1, 63, 64, 65, 4095, 4096, 4097, 100000, 262143, 262144, 300000};
+    std::vector<uint64_t> fired(delays.size(), 0);
+    for (std::size_t i = 0; i < delays.size(); ++i)
+    {
+        wheel.schedule(delays[i], [&wheel, &fired, i]() { fired[i] = wheel.now(); });
+    }
+
+    //Uneven steps of the manual clock
+    for (uint64_t now = 0; now < 300100; now += 7)
+    {
+        wheel.tick(now);
+    }
+    wheel.tick(300100);
+
+    for (std::size_t i = 0; i < delays.size(); ++i)
+    {
+        expect_equal("single shot expiry", fired[i], delays[i] ? delays[i] : 1);
+    }
+    expect_equal("single shot size", wheel.size(), 0);
+}
+
+void test_periodic_and_cancel()
+{
+    TDelegateTimerWheel wheel(1000);
+    int periodic{0}, cancelled{0}, self{0};
+
+    wheel.schedule_periodic(10, [&periodic]() { ++periodic; });
+    auto handle = wheel.schedule(50, [&cancelled]() { ++cancelled; });
+    TDelegateTimerHandle selfHandle;
+    selfHandle = wheel.schedule_periodic(5, [&]() 
+    {
+        if (++self == 3)
+        {
+            wheel.cancel(selfHandle);
+        }
+    });
+
+    wheel.tick(1040);
+    expect_equal("cancel active", wheel.cancel(handle), 1);
+    expect_equal("cancel twice", wheel.cancel(handle), 0);
+    wheel.tick(1100);
+
+    expect_equal("periodic count", periodic, 10);
+    expect_equal("cancelled count", cancelled, 0);
+    expect_equal("self cancelled count", self, 3);
+    expect_equal("stale handle", wheel.active(selfHandle), 0);
+    expect_equal("remaining timers", wheel.size(), 1);
+}
+
+void test_random()
+{
+    std::mt19937_64 random(42);
+    TDelegateTimerWheel wheel;
+    std::map<uint32_t, uint64_t> expected;
+    std::vector<std::pair<TDelegateTimerHandle, uint32_t>> handles;
+    uint32_t id{0};
+    unsigned long long mismatches{0}, fired{0};
+
+    for (uint64_t now = 0; now < 200000; now += 1 + random() % 50)
+    {
+        wheel.tick(now);
+        for (int i = 0; i < 4; ++i)
+        {
+            const uint64_t delay = 1 + random() % (random() % 2 ? 100 : 20000);
+            const uint32_t timer = id++;
+            expected[timer] = now + delay;
+            handles.emplace_back(wheel.schedule(delay, [&, timer]()
+            {
+                mismatches += expected[timer] != wheel.now();
+                expected.erase(timer);
+                ++fired;
+            }), timer);
+        }
+        //Cancel the random timer, fired ones report false
+        auto& [handle, timer] = handles[random() % handles.size()];
+        if (wheel.cancel(handle))
+        {
+            expected.erase(timer);
+        }
+    }
+    wheel.tick(300000);
+
+    expect_equal("random mismatches", mismatches, 0);
+    expect_equal("random pending", expected.size(), 0);
+    expect_equal("random size", wheel.size(), 0);
+    expect_equal("random fired", fired > 0, 1);
+}
+
+void test_throwing_delegate()
+{
+    TDelegateTimerWheel wheel;
+    int periodic{0}, sibling{0};
+    auto once = wheel.schedule(10, []() { throw std::runtime_error("once"); });
+    auto repeated = wheel.schedule_periodic(20, [&periodic]()
+    {
+        if (++periodic == 1)
+        {
+            throw std::runtime_error("periodic");
+        }
+    });
+    wheel.schedule(20, [&sibling]() { ++sibling; });
+
+    bool thrown{false};
+    try
+    {
+        wheel.tick(15);
+    }
+    catch (const std::runtime_error&)
+    {
+        thrown = true;
+    }
+    expect_equal("one shot throws", thrown, 1);
+    expect_equal("one shot released", wheel.active(once), 0);
+    expect_equal("size after one shot", wheel.size(), 2);
+
+    //Timers of the same tick run after the throwing one, either in the same or in the next call
+    thrown = false;
+    try
+    {
+        wheel.tick(20);
+    }
+    catch (const std::runtime_error&)
+    {
+        thrown = true;
+    }
+    expect_equal("periodic throws", thrown, 1);
+    expect_equal("periodic re-armed", wheel.active(repeated), 1);
+    wheel.tick(20);
+    expect_equal("sibling fired", sibling, 1);
+    expect_equal("clock after throw", wheel.now(), 20);
+
+    wheel.tick(60);
+    expect_equal("periodic after throw", periodic, 3);
+    expect_equal("size after throw", wheel.size(), 1);
+
+    //Released slots are reused instead of growing the storage
+    auto reused = wheel.schedule(5, []() {});
+    expect_equal("slot reused", reused.index < 3, 1);
+    expect_equal("stale handle after reuse", wheel.active(once), 0);
+}
+
+void test_long_jump()
+{
+    TDelegateTimerWheel wheel;
+    std::vector<uint64_t> delays{3, 70, 5000, 250000, 10000000};
+    std::vector<uint64_t> fired(delays.size(), 0);
+    for (std::size_t i = 0; i < delays.size(); ++i)
+    {
+        wheel.schedule(delays[i], [&wheel, &fired, i]() { fired[i] = wheel.now(); });
+    }
+    int periodic{0};
+    wheel.schedule_periodic(1000000, [&periodic]() { ++periodic; });
+
+    expect_equal("long jump fired", wheel.tick(20000000), delays.size() + 20);
+    for (std::size_t i = 0; i < delays.size(); ++i)
+    {
+        expect_equal("long jump expiry", fired[i], delays[i]);
+    }
+    expect_equal("long jump periodic", periodic, 20);
+    expect_equal("long jump clock", wheel.now(), 20000000);
+}
+
+int main()
+{
+    test_single_shot();
+    test_periodic_and_cancel();
+    test_random();
+    test_throwing_delegate();
+    test_long_jump();
+
+    return finish("timer wheel");
+}
@@ -0,0 +1,212 @@
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "EasyDelegate.hpp"
+#include "TestHarness.hpp"
+
+using namespace EasyDelegate;
+using namespace EasyDelegateTest;
+
+// Flushes TDelegateTracing into a string and checks the Chrome trace-event JSON: the envelope, names and order of nested
+// begin/end events, one tid per thread, and that ring overflows and calls running at the flush never leave a begin or
+// an end event without its pair.
+
+enum class EFrame
+{
+    EUpdate,
+    ERender
+};
+
+namespace
+{
+    struct FEvent
+    {
+        std::string name;
+        char phase;
+        int thread;
+    };
+
+    std::string field(const std::string& line, const std::string& name)
+    {
+        const std::string prefix = "\"" + name + "\":";
+        const std::size_t start = line.find(prefix);
+        if (start == std::string::npos)
+        {
+            return {};
+        }
+        std::size_t begin = start + prefix.size();
+        if (line[begin] == '"')
+        {
+            //Strings keep their escapes
+            std::size_t end = ++begin;
+            while (end < line.size() && line[end] != '"')
+            {
+                end += line[end] == '\\' ? 2 : 1;
+            }
+            return line.substr(begin, end - begin);
+        }
+        return line.substr(begin, line.find_first_of(",}", begin) - begin);
+    }
+
+    //Checks the envelope and returns events in the written order
+    std::vector<FEvent> parse(const std::string& json)
+    {
+        expect_equal("trace envelope begin", json.rfind("{\"traceEvents\":[", 0) == 0, true);
+        expect_equal("trace envelope end", json.size() >= 4 && json.compare(json.size() - 4, 4, "\n]}\n") == 0, true);
+
+        std::vector<FEvent> events;
+        std::istringstream stream(json);
+        std::string line;
+        while (std::getline(stream, line))
+        {
+            if (line.rfind("{\"name\"", 0) != 0)
+            {
+                continue;
+            }
+            expect_equal("event category", field(line, "cat") == "delegate", true);
+            expect_equal("event timestamp", field(line, "ts").find('.') != std::string::npos, true);
+            const std::string phase = field(line, "ph");
+            events.push_back({field(line, "name"), phase.empty() ? '?' : phase[0], std::stoi(field(line, "tid"))});
+        }
+        return events;
+    }
+
+    //Every end closes the innermost open begin of the same thread and name, nothing stays open
+    bool balanced(const std::vector<FEvent>& events)
+    {
+        std::vector<std::vector<std::string>> open(64);
+        for (const auto& event : events)
+        {
+            auto& stack = open[static_cast<std::size_t>(event.thread) % open.size()];
+            if (event.phase == 'B')
+            {
+                stack.push_back(event.name);
+            }
+            else if (event.phase != 'E' || stack.empty() || stack.back() != event.name)
+            {
+                return false;
+            }
+            else
+            {
+                stack.pop_back();
+            }
+        }
+        for (const auto& stack : open)
+        {
+            if (!stack.empty())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    std::vector<FEvent> flush_events(std::size_t (*flush)(std::ostream&))
+    {
+        std::ostringstream stream;
+        const std::size_t count = flush(stream);
+        auto events = parse(stream.str());
+        expect_equal("flush count", static_cast<long long>(count), static_cast<long long>(events.size()));
+        return events;
+    }
+}
+
+void test_nested_structure()
+{
+    struct FTag {};
+    using trace_t = TDelegateTracing<FTag>;
+    trace_t::name(EFrame::EUpdate, "Update");
+    trace_t::name(EFrame::ERender, "Render \"main\"");
+
+    TDelegate<void(int), trace_t> culling([](int) {});
+    TDelegateMulti<EFrame, void(int), __EnumeratorComp<EFrame>, trace_t> frame;
+    frame.attach<EFrame::EUpdate>([](int) {});
+    frame.attach<EFrame::ERender>([&culling](int value) { culling(value); });
+    frame.execute(1);
+
+    const auto events = flush_events(&trace_t::flush);
+    expect_equal("event count", static_cast<long long>(events.size()), 6);
+    expect_equal("balanced", balanced(events), true);
+    if (events.size() == 6)
+    {
+        const char* names[] = {"Update", "Update", "Render \\\"main\\\"", "delegate", "delegate", "Render \\\"main\\\""};
+        const char phases[] = {'B', 'E', 'B', 'B', 'E', 'E'};
+        for (std::size_t index = 0; index < events.size(); ++index)
+        {
+            expect_equal("nested name", events[index].name == names[index], true);
+            expect_equal("nested phase", events[index].phase, phases[index]);
+        }
+    }
+    expect_equal("empty after flush", static_cast<long long>(flush_events(&trace_t::flush).size()), 0);
+}
+
+void test_threads()
+{
+    struct FTag {};
+    using trace_t = TDelegateTracing<FTag>;
+    TDelegate<void(), trace_t> tick([]() {});
+
+    tick();
+    std::thread([&tick]() { tick(); tick(); }).join();
+
+    const auto events = flush_events(&trace_t::flush);
+    expect_equal("events of both threads", static_cast<long long>(events.size()), 6);
+    expect_equal("balanced per thread", balanced(events), true);
+    int threads{0};
+    for (std::size_t index = 1; index < events.size(); ++index)
+    {
+        threads += events[index].thread != events[index - 1].thread ? 1 : 0;
+    }
+    expect_equal("one tid per thread", threads, 1);
+}
+
+void test_overflow_keeps_pairs()
+{
+    struct FTag {};
+    using trace_t = TDelegateTracing<FTag, 16>;
+    TDelegate<void(), trace_t> inner([]() {});
+    TDelegate<void(), trace_t> outer([&inner]() { inner(); });
+    trace_t::name(DelegateKeyIndex, "call");
+
+    //Four nested calls write 16 events, the last plain call overwrites the two begins of the first nested call
+    for (int call = 0; call < 4; ++call)
+    {
+        outer();
+    }
+    inner();
+
+    const auto events = flush_events(&trace_t::flush);
+    expect_equal("ends of overwritten begins dropped", static_cast<long long>(events.size()), 14);
+    expect_equal("balanced after overflow", balanced(events), true);
+}
+
+void test_flush_inside_call()
+{
+    struct FTag {};
+    using trace_t = TDelegateTracing<FTag>;
+    std::vector<FEvent> inside;
+    TDelegate<void(), trace_t> quick([]() {});
+    TDelegate<void(), trace_t> flushing([&inside, &quick]()
+    {
+        quick();
+        inside = flush_events(&trace_t::flush);
+    });
+
+    flushing();
+    expect_equal("running call left out", static_cast<long long>(inside.size()), 2);
+    expect_equal("balanced inside the call", balanced(inside), true);
+
+    const auto after = flush_events(&trace_t::flush);
+    expect_equal("end of the flushed call dropped", static_cast<long long>(after.size()), 0);
+}
+
+int main()
+{
+    test_nested_structure();
+    test_threads();
+    test_overflow_keeps_pairs();
+    test_flush_inside_call();
+
+    return finish("tracing");
+}